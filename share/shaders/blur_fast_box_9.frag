@@ -1,4 +1,5 @@
 #include "flat_pipeline_interface.glsl"
+#include "render_region.glsl"
 
 #if BLUR_DIM == 1
 #define BLUR_TYPE float
@@ -21,9 +22,9 @@ void main()
     vec2 off2 = vec2(3.5) * direction;
     out_tex = (
     BLUR_TYPE(texture(u_input, fpi.texCoord))
-    + BLUR_TYPE(texture(u_input, fpi.texCoord + off1))
-    + BLUR_TYPE(texture(u_input, fpi.texCoord - off1))
-    + BLUR_TYPE(texture(u_input, fpi.texCoord + off2))
-    + BLUR_TYPE(texture(u_input, fpi.texCoord - off2))
+    + BLUR_TYPE(texture(u_input, clampToRenderRegion(u_input, fpi.texCoord + off1)))
+    + BLUR_TYPE(texture(u_input, clampToRenderRegion(u_input, fpi.texCoord - off1)))
+    + BLUR_TYPE(texture(u_input, clampToRenderRegion(u_input, fpi.texCoord + off2)))
+    + BLUR_TYPE(texture(u_input, clampToRenderRegion(u_input, fpi.texCoord - off2)))
     ) * (1.0 / 5.0);
 }
@@ -1,4 +1,5 @@
 #include "flat_pipeline_interface.glsl"
+#include "render_region.glsl"
 
 #if BLUR_DIM == 1
 #define BLUR_TYPE float
@@ -20,7 +21,7 @@ void main()
     vec2 off1 = vec2(1 + 1.0/3.0) * direction;
     out_tex = (
     BLUR_TYPE(texture(u_input, fpi.texCoord)) * 0.29411764705882354
-    + BLUR_TYPE(texture(u_input, fpi.texCoord + off1)) * 0.35294117647058826
-    + BLUR_TYPE(texture(u_input, fpi.texCoord - off1)) * 0.35294117647058826
+    + BLUR_TYPE(texture(u_input, clampToRenderRegion(u_input, fpi.texCoord + off1))) * 0.35294117647058826
+    + BLUR_TYPE(texture(u_input, clampToRenderRegion(u_input, fpi.texCoord - off1))) * 0.35294117647058826
     );
 }
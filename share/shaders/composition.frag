@@ -4,6 +4,7 @@ layout(bindless_sampler) uniform sampler2D u_portalPosition;
 layout(bindless_sampler) uniform sampler2D u_portalPerturb;
 
 #include "flat_pipeline_interface.glsl"
+#include "render_region.glsl"
 #include "camera_interface.glsl"
 #include "time_uniform.glsl"
 
@@ -32,7 +33,7 @@ void main()
     float pDepth = -texture(u_portalPosition, uv).x;
     float geomDepth = -texture(u_geometryPosition, uv).z;
     vec3 dUvSpecular = texture(u_portalPerturb, uv).xyz;
-    vec2 pUv = uv + dUvSpecular.xy;
+    vec2 pUv = clampToRenderRegion(u_texture, uv + dUvSpecular.xy * u_uvScale);
     float pUvD = -texture(u_geometryPosition, pUv).z;
     float whiteness = 0;
     float shadeDepth = geomDepth;
@@ -5,6 +5,14 @@ uniform mat4 u_mvp;
 
 void main()
 {
+    #ifdef SKELETAL
+    if (isBoneHidden(int(a_boneIndex)))
+    {
+        // place all vertices of a hidden bone outside of the clip volume, which discards its triangles
+        gl_Position = vec4(0.0, 0.0, 2.0, 1.0);
+        return;
+    }
+    #endif
     #ifdef SKELETAL
     gl_Position = u_mvp * boneTransform.m[int(a_boneIndex)] * vec4(a_position, 1);
     #else
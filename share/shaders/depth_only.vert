@@ -1,12 +1,26 @@
 #include "vtx_input.glsl"
 #include "transform_interface.glsl"
 #include "camera_interface.glsl"
+#include "texture_animation.glsl"
 
 #include "geometry_pipeline_interface.glsl"
 
 void main()
 {
-    gpi.texCoord = a_texCoord;
+    #ifdef SKELETAL
+    if (isBoneHidden(int(a_boneIndex)))
+    {
+        // place all vertices of a hidden bone outside of the clip volume, which discards its triangles
+        gl_Position = vec4(0.0, 0.0, 2.0, 1.0);
+        return;
+    }
+    #endif
+    vec3 texCoord = a_texCoord;
+    vec4 quadUv12 = a_quadUv12;
+    vec4 quadUv34 = a_quadUv34;
+    apply_texture_animation(texCoord, quadUv12, quadUv34);
+
+    gpi.texCoord = texCoord;
     gpi.color = a_color;
 
     #ifdef SKELETAL
@@ -1,4 +1,5 @@
 #include "camera_interface.glsl"
+#include "render_region.glsl"
 
 #ifdef IN_WATER
 float dof_start = 32.0 * InvFarPlane;
@@ -8,7 +9,7 @@ float dof_focal_depth = 1536.0 * InvFarPlane;
 float dof_start = 128.0 * InvFarPlane;
 float dof_dist = 20*1024.0 * InvFarPlane;
 // autofocus
-float dof_focal_depth = -texture(u_geometryPosition, vec2(0.5)).z * InvFarPlane;
+float dof_focal_depth = -texture(u_geometryPosition, vec2(0.5) * u_uvScale).z * InvFarPlane;
 #endif
 const float DofBlurRange = 3;
 
@@ -42,7 +43,7 @@ vec3 do_dof(in vec2 uv)
         {
             vec2 dxy = vec2(cos(angle), sin(angle)) * float(i);
             float weight = mix(1.0, bokehFactor, BokehBias);
-            vec2 sampleUv = dxy*blur_radius + uv;
+            vec2 sampleUv = clampToRenderRegion(u_texture, dxy*blur_radius + uv);
             col = shaded_texel(u_texture, sampleUv, -texture(u_geometryPosition, sampleUv).z) * weight + col;
             weight_sum += weight;
             angle += angleDelta;
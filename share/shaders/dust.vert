@@ -1,8 +1,13 @@
-#include "vtx_input.glsl"
 #include "transform_interface.glsl"
 #include "time_uniform.glsl"
 #include "noise.glsl"
 
+// particles are placed on a jittered grid within the room's bounding box, the vertex id being the cell index
+layout(location=1) uniform vec3 u_dustGridOrigin;
+layout(location=2) uniform vec3 u_dustGridSize;
+layout(location=3) uniform float u_dustResolution;
+layout(location=4) uniform uint u_dustSeed;
+
 out DustVSInterface {
     float alpha;
     float size;
@@ -11,10 +16,39 @@ out DustVSInterface {
 const float MaxLifetime = 8;
 const float MaxDistance = 256;
 
+// https://jcgt.org/published/0009/03/02/
+uvec3 pcg3d(uvec3 v)
+{
+    v = v * 1664525u + 1013904223u;
+    v.x += v.y*v.z;
+    v.y += v.z*v.x;
+    v.z += v.x*v.y;
+    v ^= v >> 16u;
+    v.x += v.y*v.z;
+    v.y += v.z*v.x;
+    v.z += v.x*v.y;
+    return v;
+}
+
 void main()
 {
-    vec3 n = snoise3(a_position.xyz);
-    vec3 n2 = snoise3(a_position.zxy);
+    ivec3 gridSize = ivec3(u_dustGridSize);
+    if (gl_VertexID >= gridSize.x * gridSize.y * gridSize.z) {
+        // the shared index buffer may be larger than this room's grid
+        vs.alpha = 0;
+        vs.size = -1;
+        gl_Position = vec4(0);
+        return;
+    }
+
+    ivec3 cell = ivec3(gl_VertexID / (gridSize.y * gridSize.z),
+                       (gl_VertexID / gridSize.z) % gridSize.y,
+                       gl_VertexID % gridSize.z);
+    vec3 jitter = vec3(pcg3d(uvec3(cell) + uvec3(u_dustSeed))) / float(0xffffffffu) - 0.5;
+    vec3 basePos = u_dustGridOrigin + (vec3(cell) + 1 + jitter) * u_dustResolution;
+
+    vec3 n = snoise3(basePos.xyz);
+    vec3 n2 = snoise3(basePos.zxy);
 
     float randS = pow(0.5, 0.5 * n.y + 1) * pow(0.5, 1 - (0.5 * n.y + 1));
     vs.size = 0.5 + randS*4;
@@ -23,12 +57,12 @@ void main()
 
     float t = mod(TimeSeconds, particleMaxLifetime);
     float t0 = TimeSeconds - t;
-    vec3 pnoise = snoise3(a_position.xyz + vec3(t0*3, t0*2, t0));
-    vec3 normal = snoise3(a_position.zyx + pnoise);
-    float distance = snoise3(a_position.zyx - pnoise).x * MaxDistance;
+    vec3 pnoise = snoise3(basePos.xyz + vec3(t0*3, t0*2, t0));
+    vec3 normal = snoise3(basePos.zyx + pnoise);
+    float distance = snoise3(basePos.zyx - pnoise).x * MaxDistance;
 
     float lifetime = t / particleMaxLifetime;
     vs.alpha = clamp(min(lifetime, 1.0-lifetime) * 3.0, 0.0, 1.0) * 0.3;
-    vec3 pos = a_position + normal * distance * (t+pnoise.y) / particleMaxLifetime;
+    vec3 pos = basePos + normal * distance * (t+pnoise.y) / particleMaxLifetime;
     gl_Position = modelTransform.m * vec4(pos, 1);
 }
@@ -1,5 +1,6 @@
 #include "vtx_input.glsl"
 #include "flat_pipeline_interface.glsl"
+#include "render_region.glsl"
 
 #ifdef ASPECT_RATIO
 #include "camera_interface.glsl"
@@ -26,5 +27,5 @@ void main()
         #endif
 
     gl_Position = vec4(p.x, p.y, 0, 1);
-    fpi.texCoord = a_texCoord.xy;
+    fpi.texCoord = a_texCoord.xy * u_uvScale;
 }
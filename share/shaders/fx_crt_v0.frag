@@ -2,15 +2,16 @@
 #include "time_uniform.glsl"
 #include "flat_pipeline_interface.glsl"
 #include "fx_input.glsl"
+#include "render_region.glsl"
 
 vec3 crt(in vec2 uv)
 {
     const float NoiseIntensity = 0.01;
 
     vec3 col;
-    col.r = texture(u_input, vec2(uv.x+0.001, uv.y+0.001)).r;
-    col.g = texture(u_input, vec2(uv.x+0.000, uv.y-0.002)).g;
-    col.b = texture(u_input, vec2(uv.x-0.002, uv.y+0.000)).b;
+    col.r = texture(u_input, clampToRenderRegion(u_input, vec2(uv.x+0.001, uv.y+0.001))).r;
+    col.g = texture(u_input, clampToRenderRegion(u_input, vec2(uv.x+0.000, uv.y-0.002))).g;
+    col.b = texture(u_input, clampToRenderRegion(u_input, vec2(uv.x-0.002, uv.y+0.000))).b;
 
     float vig = 16.0 * fpi.texCoord.x * fpi.texCoord.y * (1.0-fpi.texCoord.x) * (1.0-fpi.texCoord.y);
     col *= vec3(pow(vig, 0.3));
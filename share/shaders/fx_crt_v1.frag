@@ -2,6 +2,7 @@
 
 #include "flat_pipeline_interface.glsl"
 #include "fx_input.glsl"
+#include "render_region.glsl"
 #include "util.glsl"
 
 // Hardness of scanline.
@@ -21,10 +22,11 @@ const float maskLight=1.5;
 //------------------------------------------------------------------------
 
 // Nearest emulated sample given floating point position and texel offset.
-// Also zero's off screen.
+// Also clamps to the covered part of the input.
 vec3 Fetch(in ivec2 off, in vec2 res)
 {
-    return toLinear(texelFetch(u_input, ivec2(fpi.texCoord*res) + off, 0).rgb);
+    ivec2 p = clamp(ivec2(fpi.texCoord*res) + off, ivec2(0), ivec2(res*u_uvScale) - ivec2(1));
+    return toLinear(texelFetch(u_input, p, 0).rgb);
 }
 
 // Distance in emulated pixels to nearest texel.
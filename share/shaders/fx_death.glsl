@@ -0,0 +1,15 @@
+#include "util.glsl"
+
+layout(location=1) uniform float u_strength;
+
+vec3 do_death(in vec3 col, in vec2 uv)
+{
+    float lum = luminanceRgb(col);
+
+    float vig = uv.x * uv.y * (1.0-uv.x) * (1.0-uv.y);
+    lum *= sqrt(vig*2);
+
+    vec3 monochrome = vec3(lum, lum, lum);
+
+    return mix(col, monochrome, clamp(u_strength, 0, 1));
+}
@@ -0,0 +1,8 @@
+#include "noise.glsl"
+#include "time_uniform.glsl"
+
+vec3 do_film_grain(in vec3 col, in vec2 uv)
+{
+    float grain = noise(uv * TimeSeconds)*0.5 + 1.0;
+    return col * grain;
+}
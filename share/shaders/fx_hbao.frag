@@ -1,9 +1,8 @@
 #include "flat_pipeline_interface.glsl"
 #include "fx_input.glsl"
-
-layout(bindless_sampler) uniform sampler2D u_ao;
+#include "hbao_upsample.glsl"
 
 void main()
 {
-    out_color = texture(u_ao, fpi.texCoord).r * texture(u_input, fpi.texCoord).rgb;
+    out_color = upsample_ao(fpi.texCoord) * texture(u_input, fpi.texCoord).rgb;
 }
@@ -1,7 +1,4 @@
-#include "flat_pipeline_interface.glsl"
 #include "camera_interface.glsl"
-#include "time_uniform.glsl"
-#include "fx_input.glsl"
 
 float distortionPower = u_inWater != 0.0 ? -2.0 : -1.0;
 float absDistortionPower = abs(distortionPower);
@@ -31,8 +28,3 @@ vec2 do_lens_distortion(in vec2 uv)
         return uv;
     }
 }
-
-void main()
-{
-    out_color = texture(u_input, do_lens_distortion(fpi.texCoord)).rgb;
-}
@@ -1,7 +1,4 @@
-#include "flat_pipeline_interface.glsl"
-#include "camera_interface.glsl"
 #include "time_uniform.glsl"
-#include "fx_input.glsl"
 
 const float Frq1 = 12.6;
 const float TimeMult1 = 0.002;
@@ -24,14 +21,13 @@ void do_water_distortion(inout vec2 uv)
     do_water_distortion_frq(uv, TimeMult2, Frq2, Amplitude2);
 }
 
-void main()
+vec2 underwater_movement(in vec2 uv)
 {
-    vec2 uv = fpi.texCoord;
     if (u_inWater != 0) {
         // scale a bit to avoid edge clamping when underwater
-        uv = (fpi.texCoord - vec2(0.5)) * 0.9 + vec2(0.5);
+        uv = (uv - vec2(0.5)) * 0.9 + vec2(0.5);
         do_water_distortion(uv);
     }
 
-    out_color = texture(u_input, uv).rgb;
+    return uv;
 }
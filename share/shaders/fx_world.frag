@@ -0,0 +1,65 @@
+// all per-pixel world effects in a single pass; effects reading a neighbourhood (like FXAA) need their own pass
+
+#include "flat_pipeline_interface.glsl"
+#include "render_region.glsl"
+#include "fx_input.glsl"
+#include "util.glsl"
+
+#include "fx_underwater_movement.glsl"
+#ifdef LENS_DISTORTION
+#include "fx_lens_distortion.glsl"
+#endif
+#ifdef VELVIA
+#include "fx_velvia.glsl"
+#endif
+#include "fx_death.glsl"
+#ifdef FILM_GRAIN
+#include "fx_film_grain.glsl"
+#endif
+
+#ifdef HBAO
+#include "hbao_upsample.glsl"
+#endif
+layout(bindless_sampler) uniform sampler2D u_normal;
+layout(bindless_sampler) uniform sampler2D u_reflective;
+
+// the effects work with screen coordinates, which are mapped to the covered part of the inputs when sampling
+vec3 sample_input(in vec2 uv)
+{
+    uv = clampToRenderRegion(u_input, uv * u_uvScale);
+    vec3 color = texture(u_input, uv).rgb;
+#ifdef HBAO
+    color *= upsample_ao(uv);
+#endif
+    return color;
+}
+
+vec3 sample_moving_input(in vec2 uv)
+{
+    return sample_input(underwater_movement(uv));
+}
+
+void main()
+{
+    vec2 screenUv = fpi.texCoord / u_uvScale;
+    vec2 uv = screenUv;
+#ifdef LENS_DISTORTION
+    uv = do_lens_distortion(uv);
+#endif
+
+    vec4 reflective = texture(u_reflective, clampToRenderRegion(u_reflective, uv * u_uvScale)).rgba;
+    vec2 normal = texture(u_normal, clampToRenderRegion(u_normal, uv * u_uvScale)).xy;
+    vec3 base = sample_moving_input(uv);
+    vec3 reflected = sample_moving_input(normal*0.5 + vec2(0.5)) * reflective.rgb;
+    vec3 color = mix(base, reflected, reflective.a);
+
+#ifdef VELVIA
+    color = do_velvia(color);
+#endif
+    color = do_death(color, screenUv);
+#ifdef FILM_GRAIN
+    color = do_film_grain(color, screenUv);
+#endif
+
+    out_color = color;
+}
@@ -411,6 +411,17 @@ NOTE the other tuning knobs are now in the shader function inputs!
                                 API PORTING
 
 ============================================================================*/
+#include "render_region.glsl"
+
+// the rendered image may only cover a part of the input, see render_region.glsl; the edge search must not read the
+// stale texels outside of it
+vec4 FxaaTexTop(sampler2D tex, vec2 p) {
+    return texture(tex, clampToRenderRegion(tex, p));
+}
+
+vec4 FxaaTexOff(sampler2D tex, vec2 p, ivec2 o, vec2 r) {
+    return FxaaTexTop(tex, p + vec2(o) * r);
+}
 
 
 /*============================================================================
@@ -483,12 +494,12 @@ float fxaaQualityEdgeThresholdMin
     vec2 posM;
     posM.x = pos.x;
     posM.y = pos.y;
-    vec4 rgbyM = texture(tex, posM);
+    vec4 rgbyM = FxaaTexTop(tex, posM);
     float lumaM = FxaaLuma(rgbyM);
-    float lumaS = FxaaLuma(textureOffset(tex, posM, ivec2(0, 1)));
-    float lumaE = FxaaLuma(textureOffset(tex, posM, ivec2(1, 0)));
-    float lumaN = FxaaLuma(textureOffset(tex, posM, ivec2(0, -1)));
-    float lumaW = FxaaLuma(textureOffset(tex, posM, ivec2(-1, 0)));
+    float lumaS = FxaaLuma(FxaaTexOff(tex, posM, ivec2(0, 1), fxaaQualityRcpFrame));
+    float lumaE = FxaaLuma(FxaaTexOff(tex, posM, ivec2(1, 0), fxaaQualityRcpFrame));
+    float lumaN = FxaaLuma(FxaaTexOff(tex, posM, ivec2(0, -1), fxaaQualityRcpFrame));
+    float lumaW = FxaaLuma(FxaaTexOff(tex, posM, ivec2(-1, 0), fxaaQualityRcpFrame));
     /*--------------------------------------------------------------------------*/
     float maxSM = max(lumaS, lumaM);
     float minSM = min(lumaS, lumaM);
@@ -505,10 +516,10 @@ float fxaaQualityEdgeThresholdMin
     if (range < rangeMaxClamped)
     return rgbyM;
     /*--------------------------------------------------------------------------*/
-    float lumaNW = FxaaLuma(textureOffset(tex, posM, ivec2(-1, -1)));
-    float lumaSE = FxaaLuma(textureOffset(tex, posM, ivec2(1, 1)));
-    float lumaNE = FxaaLuma(textureOffset(tex, posM, ivec2(1, -1)));
-    float lumaSW = FxaaLuma(textureOffset(tex, posM, ivec2(-1, 1)));
+    float lumaNW = FxaaLuma(FxaaTexOff(tex, posM, ivec2(-1, -1), fxaaQualityRcpFrame));
+    float lumaSE = FxaaLuma(FxaaTexOff(tex, posM, ivec2(1, 1), fxaaQualityRcpFrame));
+    float lumaNE = FxaaLuma(FxaaTexOff(tex, posM, ivec2(1, -1), fxaaQualityRcpFrame));
+    float lumaSW = FxaaLuma(FxaaTexOff(tex, posM, ivec2(-1, 1), fxaaQualityRcpFrame));
     /*--------------------------------------------------------------------------*/
     float lumaNS = lumaN + lumaS;
     float lumaWE = lumaW + lumaE;
@@ -566,9 +577,9 @@ float fxaaQualityEdgeThresholdMin
     posP.x = posB.x + offNP.x * FXAA_QUALITY__P0;
     posP.y = posB.y + offNP.y * FXAA_QUALITY__P0;
     float subpixD = ((-2.0)*subpixC) + 3.0;
-    float lumaEndN = FxaaLuma(texture(tex, posN));
+    float lumaEndN = FxaaLuma(FxaaTexTop(tex, posN));
     float subpixE = subpixC * subpixC;
-    float lumaEndP = FxaaLuma(texture(tex, posP));
+    float lumaEndP = FxaaLuma(FxaaTexTop(tex, posP));
     /*--------------------------------------------------------------------------*/
     if (!pairN) lumaNN = lumaSS;
     float gradientScaled = gradient * 1.0/4.0;
@@ -587,8 +598,8 @@ float fxaaQualityEdgeThresholdMin
     if (!doneP) posP.y += offNP.y * FXAA_QUALITY__P1;
     /*--------------------------------------------------------------------------*/
     if (doneNP) {
-        if (!doneN) lumaEndN = FxaaLuma(texture(tex, posN.xy));
-        if (!doneP) lumaEndP = FxaaLuma(texture(tex, posP.xy));
+        if (!doneN) lumaEndN = FxaaLuma(FxaaTexTop(tex, posN.xy));
+        if (!doneP) lumaEndP = FxaaLuma(FxaaTexTop(tex, posP.xy));
         if (!doneN) lumaEndN = lumaEndN - lumaNN * 0.5;
         if (!doneP) lumaEndP = lumaEndP - lumaNN * 0.5;
         doneN = abs(lumaEndN) >= gradientScaled;
@@ -601,8 +612,8 @@ float fxaaQualityEdgeThresholdMin
         /*--------------------------------------------------------------------------*/
         #if (FXAA_QUALITY__PS > 3)
         if (doneNP) {
-            if (!doneN) lumaEndN = FxaaLuma(texture(tex, posN.xy));
-            if (!doneP) lumaEndP = FxaaLuma(texture(tex, posP.xy));
+            if (!doneN) lumaEndN = FxaaLuma(FxaaTexTop(tex, posN.xy));
+            if (!doneP) lumaEndP = FxaaLuma(FxaaTexTop(tex, posP.xy));
             if (!doneN) lumaEndN = lumaEndN - lumaNN * 0.5;
             if (!doneP) lumaEndP = lumaEndP - lumaNN * 0.5;
             doneN = abs(lumaEndN) >= gradientScaled;
@@ -615,8 +626,8 @@ float fxaaQualityEdgeThresholdMin
             /*--------------------------------------------------------------------------*/
             #if (FXAA_QUALITY__PS > 4)
             if (doneNP) {
-                if (!doneN) lumaEndN = FxaaLuma(texture(tex, posN.xy));
-                if (!doneP) lumaEndP = FxaaLuma(texture(tex, posP.xy));
+                if (!doneN) lumaEndN = FxaaLuma(FxaaTexTop(tex, posN.xy));
+                if (!doneP) lumaEndP = FxaaLuma(FxaaTexTop(tex, posP.xy));
                 if (!doneN) lumaEndN = lumaEndN - lumaNN * 0.5;
                 if (!doneP) lumaEndP = lumaEndP - lumaNN * 0.5;
                 doneN = abs(lumaEndN) >= gradientScaled;
@@ -629,8 +640,8 @@ float fxaaQualityEdgeThresholdMin
                 /*--------------------------------------------------------------------------*/
                 #if (FXAA_QUALITY__PS > 5)
                 if (doneNP) {
-                    if (!doneN) lumaEndN = FxaaLuma(texture(tex, posN.xy));
-                    if (!doneP) lumaEndP = FxaaLuma(texture(tex, posP.xy));
+                    if (!doneN) lumaEndN = FxaaLuma(FxaaTexTop(tex, posN.xy));
+                    if (!doneP) lumaEndP = FxaaLuma(FxaaTexTop(tex, posP.xy));
                     if (!doneN) lumaEndN = lumaEndN - lumaNN * 0.5;
                     if (!doneP) lumaEndP = lumaEndP - lumaNN * 0.5;
                     doneN = abs(lumaEndN) >= gradientScaled;
@@ -643,8 +654,8 @@ float fxaaQualityEdgeThresholdMin
                     /*--------------------------------------------------------------------------*/
                     #if (FXAA_QUALITY__PS > 6)
                     if (doneNP) {
-                        if (!doneN) lumaEndN = FxaaLuma(texture(tex, posN.xy));
-                        if (!doneP) lumaEndP = FxaaLuma(texture(tex, posP.xy));
+                        if (!doneN) lumaEndN = FxaaLuma(FxaaTexTop(tex, posN.xy));
+                        if (!doneP) lumaEndP = FxaaLuma(FxaaTexTop(tex, posP.xy));
                         if (!doneN) lumaEndN = lumaEndN - lumaNN * 0.5;
                         if (!doneP) lumaEndP = lumaEndP - lumaNN * 0.5;
                         doneN = abs(lumaEndN) >= gradientScaled;
@@ -657,8 +668,8 @@ float fxaaQualityEdgeThresholdMin
                         /*--------------------------------------------------------------------------*/
                         #if (FXAA_QUALITY__PS > 7)
                         if (doneNP) {
-                            if (!doneN) lumaEndN = FxaaLuma(texture(tex, posN.xy));
-                            if (!doneP) lumaEndP = FxaaLuma(texture(tex, posP.xy));
+                            if (!doneN) lumaEndN = FxaaLuma(FxaaTexTop(tex, posN.xy));
+                            if (!doneP) lumaEndP = FxaaLuma(FxaaTexTop(tex, posP.xy));
                             if (!doneN) lumaEndN = lumaEndN - lumaNN * 0.5;
                             if (!doneP) lumaEndP = lumaEndP - lumaNN * 0.5;
                             doneN = abs(lumaEndN) >= gradientScaled;
@@ -671,8 +682,8 @@ float fxaaQualityEdgeThresholdMin
                             /*--------------------------------------------------------------------------*/
                             #if (FXAA_QUALITY__PS > 8)
                             if (doneNP) {
-                                if (!doneN) lumaEndN = FxaaLuma(texture(tex, posN.xy));
-                                if (!doneP) lumaEndP = FxaaLuma(texture(tex, posP.xy));
+                                if (!doneN) lumaEndN = FxaaLuma(FxaaTexTop(tex, posN.xy));
+                                if (!doneP) lumaEndP = FxaaLuma(FxaaTexTop(tex, posP.xy));
                                 if (!doneN) lumaEndN = lumaEndN - lumaNN * 0.5;
                                 if (!doneP) lumaEndP = lumaEndP - lumaNN * 0.5;
                                 doneN = abs(lumaEndN) >= gradientScaled;
@@ -685,8 +696,8 @@ float fxaaQualityEdgeThresholdMin
                                 /*--------------------------------------------------------------------------*/
                                 #if (FXAA_QUALITY__PS > 9)
                                 if (doneNP) {
-                                    if (!doneN) lumaEndN = FxaaLuma(texture(tex, posN.xy));
-                                    if (!doneP) lumaEndP = FxaaLuma(texture(tex, posP.xy));
+                                    if (!doneN) lumaEndN = FxaaLuma(FxaaTexTop(tex, posN.xy));
+                                    if (!doneP) lumaEndP = FxaaLuma(FxaaTexTop(tex, posP.xy));
                                     if (!doneN) lumaEndN = lumaEndN - lumaNN * 0.5;
                                     if (!doneP) lumaEndP = lumaEndP - lumaNN * 0.5;
                                     doneN = abs(lumaEndN) >= gradientScaled;
@@ -699,8 +710,8 @@ float fxaaQualityEdgeThresholdMin
                                     /*--------------------------------------------------------------------------*/
                                     #if (FXAA_QUALITY__PS > 10)
                                     if (doneNP) {
-                                        if (!doneN) lumaEndN = FxaaLuma(texture(tex, posN.xy));
-                                        if (!doneP) lumaEndP = FxaaLuma(texture(tex, posP.xy));
+                                        if (!doneN) lumaEndN = FxaaLuma(FxaaTexTop(tex, posN.xy));
+                                        if (!doneP) lumaEndP = FxaaLuma(FxaaTexTop(tex, posP.xy));
                                         if (!doneN) lumaEndN = lumaEndN - lumaNN * 0.5;
                                         if (!doneP) lumaEndP = lumaEndP - lumaNN * 0.5;
                                         doneN = abs(lumaEndN) >= gradientScaled;
@@ -713,8 +724,8 @@ float fxaaQualityEdgeThresholdMin
                                         /*--------------------------------------------------------------------------*/
                                         #if (FXAA_QUALITY__PS > 11)
                                         if (doneNP) {
-                                            if (!doneN) lumaEndN = FxaaLuma(texture(tex, posN.xy));
-                                            if (!doneP) lumaEndP = FxaaLuma(texture(tex, posP.xy));
+                                            if (!doneN) lumaEndN = FxaaLuma(FxaaTexTop(tex, posN.xy));
+                                            if (!doneP) lumaEndP = FxaaLuma(FxaaTexTop(tex, posP.xy));
                                             if (!doneN) lumaEndN = lumaEndN - lumaNN * 0.5;
                                             if (!doneP) lumaEndP = lumaEndP - lumaNN * 0.5;
                                             doneN = abs(lumaEndN) >= gradientScaled;
@@ -727,8 +738,8 @@ float fxaaQualityEdgeThresholdMin
                                             /*--------------------------------------------------------------------------*/
                                             #if (FXAA_QUALITY__PS > 12)
                                             if (doneNP) {
-                                                if (!doneN) lumaEndN = FxaaLuma(texture(tex, posN.xy));
-                                                if (!doneP) lumaEndP = FxaaLuma(texture(tex, posP.xy));
+                                                if (!doneN) lumaEndN = FxaaLuma(FxaaTexTop(tex, posN.xy));
+                                                if (!doneP) lumaEndP = FxaaLuma(FxaaTexTop(tex, posP.xy));
                                                 if (!doneN) lumaEndN = lumaEndN - lumaNN * 0.5;
                                                 if (!doneP) lumaEndP = lumaEndP - lumaNN * 0.5;
                                                 doneN = abs(lumaEndN) >= gradientScaled;
@@ -792,5 +803,5 @@ float fxaaQualityEdgeThresholdMin
     float pixelOffsetSubpix = max(pixelOffsetGood, subpixH);
     if (!horzSpan) posM.x += pixelOffsetSubpix * lengthSign;
     if (horzSpan) posM.y += pixelOffsetSubpix * lengthSign;
-    return vec4(texture(tex, posM).xyz, lumaM);
+    return vec4(FxaaTexTop(tex, posM).xyz, lumaM);
 }
@@ -2,16 +2,37 @@
 #include "transform_interface.glsl"
 #include "geometry_pipeline_interface.glsl"
 #include "camera_interface.glsl"
+#include "texture_animation.glsl"
 
 #include "util.glsl"
 
 void main()
 {
+    #ifdef SKELETAL
+    if (isBoneHidden(int(a_boneIndex)))
+    {
+        // place all vertices of a hidden bone outside of the clip volume, which discards its triangles
+        gl_Position = vec4(0.0, 0.0, 2.0, 1.0);
+        return;
+    }
+    #endif
+    vec3 position = a_position;
+    vec3 texCoord = a_texCoord;
+    #ifdef INSTANCED
+    // instanced sprites draw a unit quad, which is stretched to the sprite frame of the instance
+    Instance instance = instances[gl_InstanceID];
+    position.xy = mix(instance.rect.xy, instance.rect.zw, a_position.xy);
+    texCoord = vec3(mix(instance.uv.xy, instance.uv.zw, a_texCoord.xy), instance.textureIndex);
+    #endif
+
     #ifdef SKELETAL
     mat4 mm = modelTransform.m * boneTransform.m[int(a_boneIndex)];
     #else
     mat4 mm = modelTransform.m;
     #endif
+    #ifdef INSTANCED
+    mm = mm * instance.transform;
+    #endif
     mat4 mv = camera.view * mm;
 
     #if SPRITEMODE == 1
@@ -23,16 +44,27 @@ void main()
     mv[2].xyz = vec3(0, 0, 1);
     #endif
 
-    vec4 mvPos = mv * vec4(a_position, 1.0);
+    vec4 mvPos = mv * vec4(position, 1.0);
     gpi.vertexPos = mvPos.xyz;
-    gpi.vertexPosWorld = vec3(mm * vec4(a_position, 1.0));
+    gpi.vertexPosWorld = vec3(mm * vec4(position, 1.0));
     gl_Position = camera.projection * mvPos;
-    gpi.texCoord = a_texCoord;
+
+    vec4 quadUv12 = a_quadUv12;
+    vec4 quadUv34 = a_quadUv34;
+    apply_texture_animation(texCoord, quadUv12, quadUv34);
+
+    gpi.texCoord = texCoord;
     gpi.color = gpi.texCoord.z >= 0 ? a_color : toLinear(a_color);
+    #ifdef INSTANCED
+    gpi.color.rgb *= instance.brightness;
+    #endif
 
     gpi.vertexNormalWorld = normalize(mat3(mm) * a_normal);
     gpi.hbaoNormal = normalize(mat3(mv) * a_normal);
-    vec4 pos = vec4(a_position, 1.0);
+    vec4 pos = vec4(position, 1.0);
+    #ifdef INSTANCED
+    pos = instance.transform * pos;
+    #endif
     for (int i=0; i<CSMSplits; ++i)
     {
         #ifdef SKELETAL
@@ -58,10 +90,10 @@ void main()
         tmp = mvp * vec4(a_quadVert4, 1);
         gpi.quadVerts[3] = vec3(tmp.xy / tmp.w, tmp.w);
 
-        gpi.quadUvs[0] = a_quadUv12.xy;
-        gpi.quadUvs[1] = a_quadUv12.zw;
-        gpi.quadUvs[2] = a_quadUv34.xy;
-        gpi.quadUvs[3] = a_quadUv34.zw;
+        gpi.quadUvs[0] = quadUv12.xy;
+        gpi.quadUvs[1] = quadUv12.zw;
+        gpi.quadUvs[2] = quadUv34.xy;
+        gpi.quadUvs[3] = quadUv34.zw;
     }
 
     gpi.reflective = a_reflective;
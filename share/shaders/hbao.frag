@@ -1,9 +1,17 @@
 layout(bindless_sampler) uniform sampler2D u_position;
 layout(bindless_sampler) uniform sampler2D u_normals;
+// accumulated occlusion (r) and view space depth (g) of the previous frame
+layout(bindless_sampler) uniform sampler2D u_history;
+// maps view space positions of this frame to view space positions of the previous frame
+uniform mat4 u_reprojection;
+uniform float u_historyWeight;
+uniform float u_frame;
 
 layout(location=0) out float out_ao;
+layout(location=1) out vec2 out_history;
 
 #include "flat_pipeline_interface.glsl"
+#include "render_region.glsl"
 #include "camera_interface.glsl"
 #include "noise.glsl"
 #include "constants.glsl"
@@ -13,28 +21,53 @@ vec3 angleAxis(vec3 v, vec3 axis, float theta)
     return cross(axis, v) * sin(theta) + mix(axis * dot(axis, v), v, cos(theta));
 }
 
+float accumulate(vec3 fragPos, float ao)
+{
+    // reject the history if the surface seen there is not the one seen now
+    const float MaxDepthDeviation = 0.05;
+
+    vec4 prevPos = u_reprojection * vec4(fragPos, 1.0);
+    vec4 prevClip = camera.projection * prevPos;
+    vec2 prevUv = ((prevClip.xy / prevClip.w) * vec2(0.5) + vec2(0.5)) * u_uvScale;
+    if (prevClip.w <= 0 || any(lessThan(prevUv, vec2(0))) || any(greaterThan(prevUv, u_uvScale)))
+    {
+        return ao;
+    }
+
+    vec2 history = texture(u_history, prevUv).rg;
+    if (abs(history.g - prevPos.z) > MaxDepthDeviation * abs(prevPos.z))
+    {
+        return ao;
+    }
+
+    return mix(ao, history.r, u_historyWeight);
+}
+
 void main()
 {
     const float Radius = 32;
     const float Bias = 0.025;
-    const int Dirs = 8;
+    // the directions are rotated every frame and accumulated over time, so only half of them are needed per frame
+    const int Dirs = 4;
     const float DirRotation = 2*PI/Dirs;
     const int Steps = 8;
 
+    vec2 seed = fpi.texCoord + vec2(fract(u_frame * 0.618034));
+
     vec3 fragPos = texture(u_position, fpi.texCoord).xyz;
     float stepSize = Radius / (fragPos.z*0.0001) / float(Steps+1);
     float stepSizes[Dirs];
     for (int i = 0; i < Dirs; ++i) {
-        stepSizes[i] = stepSize * snoise(fpi.texCoord + vec2(i, 0)) + stepSize;
+        stepSizes[i] = stepSize * snoise(seed + vec2(i, 0)) + stepSize;
     }
 
     vec3 normal = texture(u_normals, fpi.texCoord).xyz;
     vec3 baseTangent;
     if (abs(normal.z) > 1e-4 || abs(normal.x) > 1e-4) {
-        baseTangent = angleAxis(normalize(vec3(normal.z, 0, -normal.x)), normal, snoise(fpi.texCoord));
+        baseTangent = angleAxis(normalize(vec3(normal.z, 0, -normal.x)), normal, snoise(seed));
     }
     else {
-        baseTangent = angleAxis(normalize(vec3(normal.y, -normal.x, 0)), normal, snoise(fpi.texCoord));
+        baseTangent = angleAxis(normalize(vec3(normal.y, -normal.x, 0)), normal, snoise(seed));
     }
 
     vec3 tangents[Dirs];
@@ -51,12 +84,16 @@ void main()
         {
             d += tangent;
             vec4 offset = camera.projection * vec4(d, 1.0);
-            vec3 k = texture(u_position, (offset.xy / offset.w) * vec2(0.5) + vec2(0.5)).xyz;
+            vec2 uv = ((offset.xy / offset.w) * vec2(0.5) + vec2(0.5)) * u_uvScale;
+            vec3 k = texture(u_position, clampToRenderRegion(u_position, uv)).xyz;
             vec3 vk = k - fragPos;
             float lvk = 1.0 / length(vk);
             float w = min(Radius * lvk, 1);
             occlusion += w * max(dot(vk, normal) * lvk - Bias, 0);
         }
     }
-    out_ao = pow(1 - occlusion / (Steps*Dirs), 1.5);
+
+    float ao = accumulate(fragPos, pow(1 - occlusion / (Steps*Dirs), 1.5));
+    out_ao = ao;
+    out_history = vec2(ao, fragPos.z);
 }
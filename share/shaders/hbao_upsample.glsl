@@ -0,0 +1,32 @@
+// depth-aware upsampling of the low resolution ambient occlusion, so that it does not bleed over depth edges
+
+#include "render_region.glsl"
+
+layout(bindless_sampler) uniform sampler2D u_ao;
+layout(bindless_sampler) uniform sampler2D u_position;
+
+float upsample_ao(in vec2 uv)
+{
+    vec2 aoSize = vec2(textureSize(u_ao, 0));
+    vec2 texel = uv * aoSize - vec2(0.5);
+    vec2 base = floor(texel);
+    vec2 f = texel - base;
+    float depth = texture(u_position, uv).z;
+
+    float sum = 0.0;
+    float weightSum = 0.0;
+    for (int y = 0; y < 2; ++y)
+    {
+        for (int x = 0; x < 2; ++x)
+        {
+            // the occlusion was calculated from the full resolution position at the low resolution texel centers
+            vec2 sampleUv = clampToRenderRegion(u_ao, (base + vec2(x, y) + vec2(0.5)) / aoSize);
+            float sampleDepth = texture(u_position, sampleUv).z;
+            vec2 bilinear = mix(vec2(1.0) - f, f, vec2(x, y));
+            float w = bilinear.x * bilinear.y / (1e-3 + abs(sampleDepth - depth) / max(abs(depth), 1.0));
+            sum += w * texture(u_ao, sampleUv).r;
+            weightSum += w;
+        }
+    }
+    return sum / max(weightSum, 1e-6);
+}
@@ -0,0 +1,27 @@
+// reduces the depth buffer to the maximum depth of each tile
+#include "flat_pipeline_interface.glsl"
+#include "render_region.glsl"
+
+layout(bindless_sampler) uniform sampler2D u_depth;
+
+layout(location=0) out float out_depth;
+
+// must match render::scene::HiZBuffer::TileSize
+const int TileSize = 16;
+
+void main()
+{
+    // don't reduce the uncovered part of the depth buffer
+    ivec2 size = ivec2(ceil(vec2(textureSize(u_depth, 0)) * u_uvScale));
+    ivec2 base = ivec2(gl_FragCoord.xy) * TileSize;
+
+    float depth = 0.0;
+    for (int y = 0; y < TileSize; ++y)
+    {
+        for (int x = 0; x < TileSize; ++x)
+        {
+            depth = max(depth, texelFetch(u_depth, min(base + ivec2(x, y), size - ivec2(1)), 0).r);
+        }
+    }
+    out_depth = depth;
+}
@@ -0,0 +1,11 @@
+// the rendered image may only cover the lower left part of the render targets, see render::RenderRegion;
+// texture coordinates of the covered part are in the range [0, u_uvScale]
+layout(location=12) uniform vec2 u_uvScale = vec2(1.0);
+
+// clamps texture coordinates to the texel centers at the border of the covered part, so that filters sampling around
+// a texel near its border, e.g. bilinear filtering, blurs or FXAA, don't read the stale texels outside of it
+vec2 clampToRenderRegion(sampler2D tex, vec2 uv)
+{
+    vec2 halfTexel = 0.5 / vec2(textureSize(tex, 0));
+    return clamp(uv, halfTexel, u_uvScale - halfTexel);
+}
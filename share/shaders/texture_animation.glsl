@@ -0,0 +1,29 @@
+struct TextureAnimationTile {
+    vec4 uv01;
+    vec4 uv23;
+    float textureIndex;
+};
+
+layout(std430, binding=5) readonly restrict buffer b_textureAnimationTiles {
+    TextureAnimationTile textureAnimationTiles[];
+};
+
+layout(location=11) uniform int u_textureAnimationStep;
+
+// a_textureAnimation: x = first tile of the sequence, y = sequence length (0 if not animated),
+// z = offset of the vertex's own tile within the sequence, w = corner of the tile
+void apply_texture_animation(inout vec3 texCoord, inout vec4 quadUv12, inout vec4 quadUv34)
+{
+    int sequenceLength = int(a_textureAnimation.y);
+    if (sequenceLength <= 0)
+    {
+        return;
+    }
+
+    int offset = (int(a_textureAnimation.z) + u_textureAnimationStep) % sequenceLength;
+    TextureAnimationTile tile = textureAnimationTiles[int(a_textureAnimation.x) + offset];
+    vec2 uvs[4] = vec2[4](tile.uv01.xy, tile.uv01.zw, tile.uv23.xy, tile.uv23.zw);
+    texCoord = vec3(uvs[int(a_textureAnimation.w)], tile.textureIndex);
+    quadUv12 = tile.uv01;
+    quadUv34 = tile.uv23;
+}
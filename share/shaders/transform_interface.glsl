@@ -6,4 +6,27 @@ layout(std140, binding=0) uniform Transform {
 layout(std140) readonly restrict buffer BoneTransform {
     mat4 m[];
 } boneTransform;
+
+// hidden bones have a zero w component in their translation column, their vertices must not be transformed
+bool isBoneHidden(int boneIndex)
+{
+    return boneTransform.m[boneIndex][3][3] == 0.0;
+}
+#endif
+
+#ifdef INSTANCED
+struct Instance {
+    // rotation and offset relative to the model transform
+    mat4 transform;
+    // the quad corners x0, y0, x1, y1 of the sprite frame drawn by this instance
+    vec4 rect;
+    // the texture coordinates u0, v0, u1, v1 at the quad corners
+    vec4 uv;
+    float brightness;
+    int textureIndex;
+};
+
+layout(std430, binding=4) readonly restrict buffer b_instances {
+    Instance instances[];
+};
 #endif
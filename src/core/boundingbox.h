@@ -1,5 +1,6 @@
 #pragma once
 
+#include "angle.h"
 #include "interval.h"
 #include "vec.h"
 
@@ -56,4 +57,34 @@ struct BoundingBox
     return x.intersectsExclusive(b.x) && y.intersectsExclusive(b.y) && z.intersectsExclusive(b.z);
   }
 };
+
+[[nodiscard]] inline BoundingBox rotateTranslate(const BoundingBox& bbox, const TRVec& pos, const Angle& angle)
+{
+  auto result = bbox;
+
+  const auto axis = axisFromAngle(angle);
+  switch(axis)
+  {
+  case Axis::Deg0:
+    // nothing to do
+    break;
+  case Axis::Right90:
+    result.x = {bbox.z.min, bbox.z.max};
+    result.z = {-bbox.x.max, -bbox.x.min};
+    break;
+  case Axis::Deg180:
+    result.x = {-bbox.x.max, -bbox.x.min};
+    result.z = {-bbox.z.max, -bbox.z.min};
+    break;
+  case Axis::Left90:
+    result.x = {-bbox.z.max, -bbox.z.min};
+    result.z = {bbox.x.min, bbox.x.max};
+    break;
+  }
+
+  result.x += pos.X;
+  result.y += pos.Y;
+  result.z += pos.Z;
+  return result;
+}
 } // namespace core
@@ -288,13 +288,13 @@ EnemyLocation::EnemyLocation(objects::AIAgent& aiAgent)
   if(aiAgent.getCreatureInfo() == nullptr)
     return;
 
-  const auto zoneRef = world::Box::getZoneRef(aiAgent.getWorld().roomsAreSwapped(),
-                                              aiAgent.getCreatureInfo()->pathFinder.isFlying(),
-                                              aiAgent.getCreatureInfo()->pathFinder.step);
+  const auto zoneRef = world::BoxZones::getZoneRef(aiAgent.getWorld().roomsAreSwapped(),
+                                                   aiAgent.getCreatureInfo()->pathFinder.isFlying(),
+                                                   aiAgent.getCreatureInfo()->pathFinder.step);
 
-  zoneId = aiAgent.m_state.getCurrentBox().get()->*zoneRef;
+  zoneId = aiAgent.m_state.getCurrentBox()->zones.*zoneRef;
   auto& lara = aiAgent.getWorld().getObjectManager().getLara();
-  enemyZoneId = lara.m_state.getCurrentBox().get()->*zoneRef;
+  enemyZoneId = lara.m_state.getCurrentBox()->zones.*zoneRef;
   enemyUnreachable = !aiAgent.getCreatureInfo()->pathFinder.canVisit(*lara.m_state.getCurrentBox())
                      || aiAgent.getCreatureInfo()->pathFinder.isUnreachable(aiAgent.m_state.getCurrentBox());
 
@@ -4,6 +4,7 @@
 #include "engine/world/box.h"
 #include "engine/world/world.h"
 #include "serialization/box_ptr.h"
+#include "serialization/default.h"
 #include "serialization/deque.h"
 #include "serialization/not_null.h"
 #include "serialization/optional.h"
@@ -19,6 +20,7 @@
 #include <boost/assert.hpp>
 #include <cstdint>
 #include <exception>
+#include <unordered_map>
 
 namespace engine::ai
 {
@@ -46,7 +48,20 @@ bool PathFinder::calculateTarget(const world::World& world,
   Expects(m_targetBox->zInterval.contains(target.Z));
   Expects(startBox->xInterval.contains(startPos.X));
   Expects(startBox->zInterval.contains(startPos.Z));
-  searchPath(world);
+
+  const auto& regionGraph = world.getBoxRegionGraph(isFlying(), step, drop);
+  const auto targetRegion = regionGraph.getRegion(*m_targetBox);
+  const auto startRegion = regionGraph.getRegion(*startBox);
+  if(&regionGraph != m_boundGraph || startRegion != m_boundStartRegion)
+  {
+    requeueDeferred();
+    m_boundGraph = &regionGraph;
+    m_boundStartRegion = startRegion;
+  }
+
+  // if the start box can't ever be reached, there's no need to search, as the start box is never visited anyway
+  if(regionGraph.canReach(targetRegion, startRegion))
+    searchPath(world, regionGraph, targetRegion, startRegion);
 
   moveTarget = startPos;
 
@@ -239,96 +254,102 @@ bool PathFinder::calculateTarget(const world::World& world,
   return false;
 }
 
-void PathFinder::searchPath(const world::World& world)
+void PathFinder::searchPath(const world::World& world,
+                            const world::BoxRegionGraph& regionGraph,
+                            const uint32_t targetRegion,
+                            const uint32_t startRegion)
 {
-  const auto zoneRef = world::Box::getZoneRef(world.roomsAreSwapped(), isFlying(), step);
+  const auto zoneRef = world::BoxZones::getZoneRef(world.roomsAreSwapped(), isFlying(), step);
+  const auto& boxes = world.getBoxes();
+  if(m_nodes.size() < boxes.size())
+    m_nodes.resize(boxes.size());
 
   static constexpr uint8_t MaxExpansions = 15;
 
-  auto setReachable = [this](const gsl::not_null<const world::Box*>& box, bool reachable)
+  auto setReachable = [this](const uint32_t boxIndex, bool reachable)
   {
-    m_reachable[box] = reachable;
-    if(std::find(m_expansions.begin(), m_expansions.end(), box) == m_expansions.end())
-      m_expansions.emplace_back(box);
-  };
-
-  auto sortPriority = [this]()
-  {
-    std::sort(m_expansions.begin(),
-              m_expansions.end(),
-              [this](const gsl::not_null<const world::Box*>& lhs, const gsl::not_null<const world::Box*>& rhs)
-              {
-                const auto lhsIt = m_distances.find(lhs);
-                const auto rhsIt = m_distances.find(rhs);
-
-                if(lhsIt == m_distances.end())
-                  return false;
-                if(rhsIt == m_distances.end())
-                  return true;
-
-                return lhsIt->second < rhsIt->second;
-              });
+    auto& node = visit(boxIndex);
+    node.reachable = reachable;
+    if(node.queued == 0)
+    {
+      m_expansions.emplace_back(boxIndex);
+      ++node.queued;
+    }
   };
 
   for(uint8_t i = 0; i < MaxExpansions && !m_expansions.empty(); ++i)
   {
-    const auto currentBox = m_expansions.front();
+    const auto currentIndex = m_expansions.front();
     m_expansions.pop_front();
-    const auto searchZone = currentBox.get()->*zoneRef;
+    Expects(tryGetNode(currentIndex) != nullptr);
+    --m_nodes[currentIndex].queued;
+
+    const auto& currentBox = boxes.at(currentIndex);
+    const auto searchZone = currentBox.zones.*zoneRef;
+    bool deferred = false;
 
-    for(const auto& successorBox : currentBox->overlaps)
+    for(const auto& overlap : currentBox.overlaps)
     {
-      if(successorBox == currentBox)
+      if(overlap.boxIndex == currentIndex)
+        continue;
+
+      if(searchZone != overlap.zones.*zoneRef)
         continue;
 
-      if(searchZone != successorBox.get()->*zoneRef)
+      if(const auto boxHeightDiff = overlap.floor - currentBox.floor; boxHeightDiff > step || boxHeightDiff < drop)
         continue;
 
-      if(const auto boxHeightDiff = successorBox->floor - currentBox->floor;
-         boxHeightDiff > step || boxHeightDiff < drop)
+      if(!regionGraph.isBetween(regionGraph.getRegion(boxes[overlap.boxIndex]), targetRegion, startRegion))
+      {
+        // the box can't be part of a path to the start box, but may become relevant if the start box changes
+        if(!deferred)
+          m_deferred.emplace_back(currentIndex);
+        deferred = true;
         continue;
+      }
 
-      const auto it = m_reachable.find(successorBox);
-      const bool successorInitialized = it != m_reachable.end();
+      const auto successorNode = tryGetNode(overlap.boxIndex);
+      const bool successorInitialized = successorNode != nullptr;
 
-      if(!m_reachable.at(currentBox))
+      if(!m_nodes[currentIndex].reachable)
       {
         // propagate "unreachable" to all connected boxes if their reachability hasn't been determined yet
         if(!successorInitialized)
         {
-          setReachable(successorBox, false);
+          setReachable(overlap.boxIndex, false);
         }
       }
       else
       {
         // propagate "reachable" to all connected boxes if their reachability hasn't been determined yet
         // OR they were previously determined to be unreachable
-        if(successorInitialized && it->second)
+        if(successorInitialized && successorNode->reachable)
         {
           // already visited and marked reachable, but path might be shorter
-          auto& successorDistance = m_distances[successorBox];
-          auto currentDistance = m_distances[currentBox] + 1;
-          if(successorDistance > currentDistance)
+          auto& successor = m_nodes[overlap.boxIndex];
+          const auto currentDistance = m_nodes[currentIndex].distance.value_or(0) + 1;
+          if(successor.distance.value_or(0) > currentDistance)
           {
-            successorDistance = currentDistance;
-            m_edges.erase(currentBox);
-            m_edges.emplace(currentBox, successorBox);
-            m_expansions.emplace_back(successorBox);
-            sortPriority();
+            successor.distance = currentDistance;
+            ++successor.queued;
+            m_nodes[currentIndex].next = &boxes[overlap.boxIndex];
+            m_expansions.emplace_back(overlap.boxIndex);
+            sortExpansions();
           }
           continue;
         }
 
-        const auto reachable = canVisit(*successorBox);
+        const auto reachable = canVisit(boxes.at(overlap.boxIndex));
         if(reachable)
         {
-          BOOST_ASSERT_MSG(m_edges.count(successorBox) == 0, "cycle in pathfinder graph detected");
-          m_edges.emplace(successorBox, currentBox); // success! connect both boxes
-          m_distances[successorBox] = m_distances[currentBox] + 1;
-          sortPriority();
+          auto& successor = visit(overlap.boxIndex);
+          BOOST_ASSERT_MSG(successor.next == nullptr, "cycle in pathfinder graph detected");
+          successor.next = &currentBox; // success! connect both boxes
+          successor.distance = m_nodes[currentIndex].distance.value_or(0) + 1;
+          sortExpansions();
         }
 
-        setReachable(successorBox, reachable);
+        setReachable(overlap.boxIndex, reachable);
       }
     }
   }
@@ -336,11 +357,14 @@ void PathFinder::searchPath(const world::World& world)
 
 void PathFinder::serialize(const serialization::Serializer<world::World>& ser)
 {
-  ser(S_NV("edges", m_edges),
+  auto state = ser.loading ? SearchState{} : getSearchState(ser.context.getBoxes());
+
+  ser(S_NV("edges", state.edges),
       S_NV("boxes", m_boxes),
-      S_NV("expansions", m_expansions),
-      S_NV("distances", m_distances),
-      S_NV("reachable", m_reachable),
+      S_NV("expansions", state.expansions),
+      S_NV("distances", state.distances),
+      S_NV("reachable", state.reachable),
+      S_NVD("deferred", state.deferred, std::vector<gsl::not_null<const world::Box*>>{}),
       S_NV("cannotVisitBlockable", cannotVisitBlockable),
       S_NV("cannotVisitBlocked", cannotVisitBlocked),
       S_NV("step", step),
@@ -348,22 +372,157 @@ void PathFinder::serialize(const serialization::Serializer<world::World>& ser)
       S_NV("fly", fly),
       S_NV_VECTOR_ELEMENT("targetBox", ser.context.getBoxes(), m_targetBox),
       S_NV("target", target));
+
+  if(ser.loading)
+    setSearchState(state, ser.context.getBoxes().size());
 }
 
 void PathFinder::collectBoxes(const world::World& world, const gsl::not_null<const world::Box*>& box)
 {
-  const auto zoneRef1 = world::Box::getZoneRef(false, isFlying(), step);
-  const auto zoneRef2 = world::Box::getZoneRef(true, isFlying(), step);
-  const auto zoneData1 = box.get()->*zoneRef1;
-  const auto zoneData2 = box.get()->*zoneRef2;
+  const auto zoneRef1 = world::BoxZones::getZoneRef(false, isFlying(), step);
+  const auto zoneRef2 = world::BoxZones::getZoneRef(true, isFlying(), step);
+  const auto zoneData1 = box->zones.*zoneRef1;
+  const auto zoneData2 = box->zones.*zoneRef2;
   m_boxes.clear();
   for(const auto& levelBox : world.getBoxes())
   {
-    if(levelBox.*zoneRef1 == zoneData1 || levelBox.*zoneRef2 == zoneData2)
+    if(levelBox.zones.*zoneRef1 == zoneData1 || levelBox.zones.*zoneRef2 == zoneData2)
     {
       m_boxes.emplace_back(&levelBox);
     }
   }
+
+  if(m_nodes.size() < world.getBoxes().size())
+    m_nodes.resize(world.getBoxes().size());
+}
+
+PathFinder::SearchState PathFinder::getSearchState(const std::vector<world::Box>& boxes) const
+{
+  SearchState state;
+  for(const auto boxIndex : m_expansions)
+    state.expansions.emplace_back(&boxes.at(boxIndex));
+  for(const auto boxIndex : m_deferred)
+    state.deferred.emplace_back(&boxes.at(boxIndex));
+
+  for(uint32_t boxIndex = 0; boxIndex < m_nodes.size(); ++boxIndex)
+  {
+    const auto node = tryGetNode(boxIndex);
+    if(node == nullptr)
+      continue;
+
+    const gsl::not_null box{&boxes.at(boxIndex)};
+    state.reachable.emplace(box, node->reachable);
+    if(node->distance.has_value())
+      state.distances.emplace(box, *node->distance);
+    if(node->next != nullptr)
+      state.edges.emplace(box, gsl::not_null{node->next});
+  }
+
+  return state;
+}
+
+void PathFinder::setSearchState(const SearchState& state, const size_t boxCount)
+{
+  resetNodes();
+  m_nodes.resize(boxCount);
+  for(const auto& [box, isReachable] : state.reachable)
+    visit(box->index).reachable = isReachable;
+  for(const auto& [box, distance] : state.distances)
+    visit(box->index).distance = distance;
+  for(const auto& [box, next] : state.edges)
+    visit(box->index).next = next;
+  for(const auto& box : state.expansions)
+  {
+    ++visit(box->index).queued;
+    m_expansions.emplace_back(box->index);
+  }
+  for(const auto& box : state.deferred)
+    m_deferred.emplace_back(box->index);
+  // the bounds are re-evaluated on the next search
+  m_boundGraph = nullptr;
+}
+
+bool PathFinder::isUnreachable(const gsl::not_null<const world::Box*>& box) const
+{
+  const auto node = tryGetNode(box->index);
+  return node != nullptr && !node->reachable;
+}
+
+const world::Box* PathFinder::getNextPathBox(const gsl::not_null<const world::Box*>& box) const
+{
+  const auto node = tryGetNode(box->index);
+  return node == nullptr ? nullptr : node->next;
+}
+
+void PathFinder::sortExpansions()
+{
+  std::sort(m_expansions.begin(),
+            m_expansions.end(),
+            [this](const uint32_t lhs, const uint32_t rhs)
+            {
+              const auto lhsNode = tryGetNode(lhs);
+              const auto rhsNode = tryGetNode(rhs);
+
+              if(lhsNode == nullptr || !lhsNode->distance.has_value())
+                return false;
+              if(rhsNode == nullptr || !rhsNode->distance.has_value())
+                return true;
+
+              return *lhsNode->distance < *rhsNode->distance;
+            });
+}
+
+PathFinder::Node& PathFinder::visit(const uint32_t boxIndex)
+{
+  if(boxIndex >= m_nodes.size())
+    m_nodes.resize(boxIndex + 1);
+
+  auto& node = m_nodes[boxIndex];
+  if(node.generation != m_generation)
+  {
+    node = Node{};
+    node.generation = m_generation;
+  }
+  return node;
+}
+
+const PathFinder::Node* PathFinder::tryGetNode(const uint32_t boxIndex) const
+{
+  if(boxIndex >= m_nodes.size() || m_nodes[boxIndex].generation != m_generation)
+    return nullptr;
+
+  return &m_nodes[boxIndex];
+}
+
+void PathFinder::requeueDeferred()
+{
+  if(m_deferred.empty())
+    return;
+
+  for(const auto boxIndex : m_deferred)
+  {
+    auto& node = visit(boxIndex);
+    if(node.queued == 0)
+    {
+      ++node.queued;
+      m_expansions.emplace_back(boxIndex);
+    }
+  }
+  m_deferred.clear();
+  sortExpansions();
+}
+
+void PathFinder::resetNodes()
+{
+  m_expansions.clear();
+  m_deferred.clear();
+  ++m_generation;
+  if(m_generation == 0)
+  {
+    // the generation counter wrapped around, so nodes from an ancient search might be considered valid again
+    std::fill(m_nodes.begin(), m_nodes.end(), Node{});
+    m_generation = 1;
+  }
 }
 
 bool PathFinder::canVisit(const world::Box& box) const noexcept
@@ -398,13 +557,12 @@ void PathFinder::setTargetBox(const gsl::not_null<const world::Box*>& box)
 
   m_targetBox = box;
 
-  m_expansions.clear();
-  m_expansions.emplace_back(m_targetBox);
-  m_distances.clear();
-  m_distances[box] = 0;
-  m_reachable.clear();
-  m_reachable[box] = true;
-  m_edges.clear();
+  resetNodes();
+  auto& node = visit(box->index);
+  node.reachable = true;
+  node.distance = 0;
+  node.queued = 1;
+  m_expansions.emplace_back(box->index);
 }
 
 const gsl::not_null<const world::Box*>& PathFinder::getRandomBox() const
@@ -7,9 +7,10 @@
 #include "serialization/serialization_fwd.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <gsl/gsl-lite.hpp>
-#include <map>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -17,6 +18,7 @@ namespace engine::world
 {
 class World;
 struct Box;
+class BoxRegionGraph;
 } // namespace engine::world
 
 namespace engine::ai
@@ -50,22 +52,28 @@ struct PathFinder
 
   void serialize(const serialization::Serializer<world::World>& ser);
 
+  //! @brief The search state keyed by box instead of by node, which keeps savegames independent of the node layout
+  struct SearchState
+  {
+    std::deque<gsl::not_null<const world::Box*>> expansions;
+    std::vector<gsl::not_null<const world::Box*>> deferred;
+    std::unordered_map<gsl::not_null<const world::Box*>, bool> reachable;
+    std::unordered_map<gsl::not_null<const world::Box*>, size_t> distances;
+    std::unordered_map<gsl::not_null<const world::Box*>, gsl::not_null<const world::Box*>> edges;
+  };
+
+  [[nodiscard]] SearchState getSearchState(const std::vector<world::Box>& boxes) const;
+  //! @brief Replaces the current search state; the search bounds are re-evaluated on the next search
+  void setSearchState(const SearchState& state, size_t boxCount);
+
   void collectBoxes(const world::World& world, const gsl::not_null<const world::Box*>& box);
 
   // returns true if and only if the box is visited and marked unreachable
-  [[nodiscard]] bool isUnreachable(const gsl::not_null<const world::Box*>& box) const
-  {
-    const auto it = m_reachable.find(box);
-    return it != m_reachable.end() && !it->second;
-  }
+  [[nodiscard]] bool isUnreachable(const gsl::not_null<const world::Box*>& box) const;
 
   [[nodiscard]] const gsl::not_null<const world::Box*>& getRandomBox() const;
 
-  [[nodiscard]] const world::Box* getNextPathBox(const gsl::not_null<const world::Box*>& box) const
-  {
-    const auto it = m_edges.find(box);
-    return it == m_edges.end() ? nullptr : it->second.get();
-  }
+  [[nodiscard]] const world::Box* getNextPathBox(const gsl::not_null<const world::Box*>& box) const;
 
   [[nodiscard]] const auto& getTargetBox() const
   {
@@ -78,13 +86,46 @@ struct PathFinder
   }
 
 private:
-  void searchPath(const world::World& world);
+  //! @brief Search state of a single box, indexed by the box index.
+  //! @details A node is only valid if its generation matches the generation of the path finder, otherwise the box
+  //!          is considered not visited yet; this avoids clearing the whole node list when the target changes.
+  struct Node
+  {
+    uint32_t generation = 0;
+    bool reachable = false;
+    //! @brief How often the box is contained in the expansion queue
+    uint32_t queued = 0;
+    std::optional<size_t> distance{};
+    const world::Box* next = nullptr;
+  };
+
+  void searchPath(const world::World& world,
+                  const world::BoxRegionGraph& regionGraph,
+                  uint32_t targetRegion,
+                  uint32_t startRegion);
+  //! @brief Re-queues all boxes with neighbours skipped by a previous, differently bounded search
+  void requeueDeferred();
+
+  //! @brief Returns the node of a box, marking it visited and resetting it if it was not visited before
+  Node& visit(uint32_t boxIndex);
+  //! @brief Returns the node of a box if it was visited, or @c nullptr otherwise
+  [[nodiscard]] const Node* tryGetNode(uint32_t boxIndex) const;
+  void resetNodes();
+  //! @brief Sorts the expansion queue by distance; boxes without a known distance are expanded last
+  void sortExpansions();
 
   std::vector<gsl::not_null<const world::Box*>> m_boxes;
-  std::deque<gsl::not_null<const world::Box*>> m_expansions;
-  std::unordered_map<gsl::not_null<const world::Box*>, bool> m_reachable;
-  std::unordered_map<gsl::not_null<const world::Box*>, size_t> m_distances;
-  std::unordered_map<gsl::not_null<const world::Box*>, gsl::not_null<const world::Box*>> m_edges;
+  std::deque<uint32_t> m_expansions;
+  std::vector<Node> m_nodes;
+  uint32_t m_generation = 1;
+  //! @brief Boxes which have not been fully expanded because some of their neighbours were outside the regions
+  //!        between target and start
+  std::vector<uint32_t> m_deferred;
+  //! @brief The region graph and start region the current search is bounded by
+  //! @{
+  const world::BoxRegionGraph* m_boundGraph = nullptr;
+  uint32_t m_boundStartRegion = 0;
+  //! @}
   //! @brief The target box we need to reach
   const world::Box* m_targetBox = nullptr;
 };
@@ -411,7 +411,7 @@ std::unordered_set<const world::Portal*> CameraController::tracePortals()
     room.node->clearScissors();
   }
 
-  return render::PortalTracer::trace(*m_location.room, *m_world);
+  return m_portalTracer.trace(*m_location.room, *m_world);
 }
 
 std::unordered_set<const world::Portal*> CameraController::update()
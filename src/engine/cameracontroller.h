@@ -8,6 +8,7 @@
 #include "floordata/types.h"
 #include "location.h"
 #include "qs/quantity.h"
+#include "render/portaltracer.h"
 #include "serialization/serialization_fwd.h"
 
 #include <cstdint>
@@ -101,6 +102,8 @@ private:
   int m_currentFixedCameraId = -1;
   core::Frame m_camOverrideTimeout{-1_frame};
 
+  render::PortalTracer m_portalTracer;
+
 public:
   explicit CameraController(const gsl::not_null<world::World*>& world, gslu::nn_shared<render::scene::Camera> camera);
 
@@ -19,6 +19,7 @@
 #include "util/helpers.h" // IWYU pragma: keep
 #include "world/world.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <gsl/gsl-lite.hpp>
 #include <tuple>
@@ -41,37 +42,6 @@ namespace
   return 1_sectors - (targetInSector - 1_len);
 }
 
-[[nodiscard]] core::BoundingBox
-  rotateTranslate(const core::BoundingBox& bbox, const core::TRVec& pos, const core::Angle& angle)
-{
-  auto result = bbox;
-
-  const auto axis = axisFromAngle(angle);
-  switch(axis)
-  {
-  case core::Axis::Deg0:
-    // nothing to do
-    break;
-  case core::Axis::Right90:
-    result.x = {bbox.z.min, bbox.z.max};
-    result.z = {-bbox.x.max, -bbox.x.min};
-    break;
-  case core::Axis::Deg180:
-    result.x = {-bbox.x.max, -bbox.x.min};
-    result.z = {-bbox.z.max, -bbox.z.min};
-    break;
-  case core::Axis::Left90:
-    result.x = {-bbox.z.max, -bbox.z.min};
-    result.z = {bbox.x.min, bbox.x.max};
-    break;
-  }
-
-  result.x += pos.X;
-  result.y += pos.Y;
-  result.z += pos.Z;
-  return result;
-}
-
 [[nodiscard]] core::Length minShift(const core::Length& min, const core::Length& max)
 {
   return min < max ? -min : max;
@@ -271,14 +241,20 @@ void CollisionInfo::initHeightInfo(const core::TRVec& laraPos, const world::Worl
   }
 }
 
-std::set<gsl::not_null<const world::Room*>> CollisionInfo::collectTouchingRooms(const core::TRVec& position,
-                                                                                const core::Length& radius,
-                                                                                const core::Length& height,
-                                                                                const world::World& world)
+CollisionInfo::TouchingRooms CollisionInfo::collectTouchingRooms(const core::TRVec& position,
+                                                                const core::Length& radius,
+                                                                const core::Length& height,
+                                                                const world::World& world)
 {
-  std::set<gsl::not_null<const world::Room*>> result;
+  TouchingRooms result;
+  const auto add = [&result](const gsl::not_null<const world::Room*>& room)
+  {
+    if(const auto it = std::lower_bound(result.begin(), result.end(), room); it == result.end() || *it != room)
+      result.insert(it, room);
+  };
+
   auto room = world.getObjectManager().getLara().m_state.location.room;
-  result.emplace(room);
+  add(room);
 
   const auto roomAt = [position, room](const core::Length& x, const core::Length& y, const core::Length& z)
   {
@@ -287,14 +263,14 @@ std::set<gsl::not_null<const world::Room*>> CollisionInfo::collectTouchingRooms(
     return tmp.room;
   };
 
-  result.emplace(roomAt(radius, 0_len, radius));
-  result.emplace(roomAt(-radius, 0_len, radius));
-  result.emplace(roomAt(radius, 0_len, -radius));
-  result.emplace(roomAt(-radius, 0_len, -radius));
-  result.emplace(roomAt(radius, -height, radius));
-  result.emplace(roomAt(-radius, -height, radius));
-  result.emplace(roomAt(radius, -height, -radius));
-  result.emplace(roomAt(-radius, -height, -radius));
+  add(roomAt(radius, 0_len, radius));
+  add(roomAt(-radius, 0_len, radius));
+  add(roomAt(radius, 0_len, -radius));
+  add(roomAt(-radius, 0_len, -radius));
+  add(roomAt(radius, -height, radius));
+  add(roomAt(-radius, -height, radius));
+  add(roomAt(radius, -height, -radius));
+  add(roomAt(-radius, -height, -radius));
   return result;
 }
 
@@ -311,14 +287,13 @@ bool CollisionInfo::checkStaticMeshCollisions(const core::TRVec& objectPos,
 
   hasStaticMeshCollision = false;
 
+  std::vector<uint32_t> colliders;
   for(const auto& room : rooms)
   {
-    for(const world::RoomStaticMesh& rsm : room->staticMeshes)
+    room->collectStaticMeshColliders(objectBox, colliders);
+    for(const auto collider : colliders)
     {
-      if(rsm.staticMesh->doNotCollide)
-        continue;
-
-      const auto meshBox = rotateTranslate(rsm.staticMesh->collisionBox, rsm.position, rsm.rotation);
+      const auto& meshBox = room->staticMeshColliders[collider];
       if(!meshBox.intersectsExclusive(objectBox))
         continue;
 
@@ -235,7 +235,7 @@ Engine::Engine(std::filesystem::path userDataPath,
     doc.load("config", *m_engineConfig, *m_engineConfig);
   }
 
-  m_presenter = std::make_shared<Presenter>(m_engineDataPath, resolution);
+  m_presenter = std::make_shared<Presenter>(m_engineDataPath, m_userDataPath, resolution);
   if(gl::hasAnisotropicFilteringExtension()
      && m_engineConfig->renderSettings.anisotropyLevel > gl::getMaxAnisotropyLevel())
   {
@@ -706,8 +706,7 @@ void Engine::applySettings()
     for(auto& room : world->getRooms())
     {
       room.collectShaderLights(m_engineConfig->renderSettings.getLightCollectionDepth());
-      room.regenerateDust(m_presenter,
-                          m_presenter->getMaterialManager()->getDustParticle(),
+      room.regenerateDust(m_presenter->getMaterialManager()->getDustParticle(),
                           m_engineConfig->renderSettings.dustActive,
                           m_engineConfig->renderSettings.dustDensity);
     }
@@ -2,8 +2,10 @@
 
 #include "abstractstatehandler.h"
 #include "engine/collisioninfo.h"
-#include "engine/particle.h"
+#include "engine/items_tr1.h"
+#include "engine/spriteparticles.h"
 #include "engine/world/skeletalmodeltype.h"
+#include "util/helpers.h"
 
 #include <gslu.h>
 
@@ -50,9 +52,8 @@ public:
       p.X += util::rand15s(r);
       p.Y += util::rand15s(r);
       p.Z += util::rand15s(r);
-      auto fx = gsl::make_shared<SparkleParticle>(Location{world.getObjectManager().getLara().m_state.location.room, p},
-                                                  world);
-      world.getObjectManager().registerParticle(fx);
+      world.getObjectManager().getSpriteParticles().sparkle.emit(
+        Location{world.getObjectManager().getLara().m_state.location.room, p});
     }
   }
 };
@@ -18,21 +18,31 @@
 #include "serialization/objectreference.h" // IWYU pragma: keep
 #include "serialization/serialization.h"
 #include "serialization/vector.h"
+#include "spriteparticles.h"
+#include "util/workerpool.h"
 #include "world/room.h"
 #include "world/sprite.h"
 #include "world/world.h"
 
 #include <algorithm>
+#include <boost/assert.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/adaptor/map.hpp>
 #include <boost/throw_exception.hpp>
 #include <exception>
 #include <limits>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
 
 namespace engine
 {
+thread_local bool ObjectManager::s_inParallelUpdate = false;
+
+ObjectManager::ObjectManager() = default;
+
+ObjectManager::~ObjectManager() = default;
+
 void ObjectManager::createObjects(world::World& world, std::vector<loader::file::Item>& items)
 {
   Expects(m_objectCounter == 0);
@@ -106,6 +116,7 @@ void ObjectManager::registerObject(const gslu::nn_shared<objects::Object>& objec
 
 std::shared_ptr<objects::Object> ObjectManager::find(const objects::Object* object, bool includeDynamicObjects) const
 {
+  BOOST_ASSERT(!s_inParallelUpdate);
   if(object == nullptr)
     return nullptr;
 
@@ -136,6 +147,7 @@ std::shared_ptr<objects::Object> ObjectManager::find(const objects::Object* obje
 
 std::shared_ptr<objects::Object> ObjectManager::getObject(ObjectId id) const
 {
+  BOOST_ASSERT(!s_inParallelUpdate);
   const auto it = m_objects.find(id);
   if(it == m_objects.end())
     return nullptr;
@@ -145,6 +157,8 @@ std::shared_ptr<objects::Object> ObjectManager::getObject(ObjectId id) const
 
 void ObjectManager::update(world::World& world, bool godMode)
 {
+  invalidateLineOfSightCache();
+
   for(const auto& object : m_dynamicObjects)
   {
     object->getNode()->setVisible(object->m_state.triggerState != objects::TriggerState::Invisible);
@@ -157,13 +171,10 @@ void ObjectManager::update(world::World& world, bool godMode)
     object->updateLighting();
   }
 
-  const auto activeObjects = m_activeObjects; // need to work on a copy because update() may modify the collection
-  for(const auto& object : activeObjects)
-  {
-    if(object.get() == m_lara) // Lara is special and needs to be updated last
-      continue;
-    object->update();
-  }
+  updateActiveObjects();
+
+  if(m_spriteParticles != nullptr)
+    m_spriteParticles->update(world);
 
   auto currentParticles = std::move(m_particles);
   for(const auto& particle : currentParticles)
@@ -183,13 +194,73 @@ void ObjectManager::update(world::World& world, bool godMode)
   {
     if(godMode && !m_lara->isDead())
       m_lara->m_state.health = core::LaraHealth;
+    invalidateLineOfSightCache();
     m_lara->update();
     m_lara->updateLighting();
   }
 
+  if(m_spriteParticles != nullptr)
+    m_spriteParticles->updateInstances();
+
   applyScheduledDeletions();
 }
 
+void ObjectManager::updateActiveObjects()
+{
+  // need to work on a copy because update() may modify the collection
+  const std::vector<gslu::nn_shared<objects::Object>> activeObjects{m_activeObjects.begin(), m_activeObjects.end()};
+
+  const auto updateSerial = [this, &activeObjects](const size_t i)
+  {
+    const auto& object = activeObjects[i];
+    if(object.get() == m_lara)
+      return;
+
+    // the previous object may have changed floor or ceiling heights
+    invalidateLineOfSightCache();
+    object->update();
+  };
+
+  // without additional hardware threads, the split update would only add overhead
+  if(m_workerPool == nullptr && std::thread::hardware_concurrency() > 1)
+    m_workerPool = std::make_unique<util::WorkerPool>();
+
+  if(m_workerPool == nullptr)
+  {
+    for(size_t i = 0; i < activeObjects.size(); ++i)
+      updateSerial(i);
+    return;
+  }
+
+  // objects are updated in the same order as with serial updates, so every object sees the side effects of all
+  // objects before it; only the parallel phases of consecutive split update objects run concurrently
+  m_workerPool->orderedSplitFor(
+    activeObjects.size(),
+    [this, &activeObjects](const size_t i)
+    {
+      const auto& object = activeObjects[i];
+      // Lara is special and needs to be updated last
+      return object.get() != m_lara && object->isParallelUpdateSafe();
+    },
+    [&activeObjects](const size_t i)
+    {
+      s_inParallelUpdate = true;
+      const auto leaveParallelUpdate = gsl::finally(
+        []()
+        {
+          s_inParallelUpdate = false;
+        });
+      activeObjects[i]->updateParallel();
+    },
+    [this, &activeObjects](const size_t i)
+    {
+      // the previous object may have changed floor or ceiling heights
+      invalidateLineOfSightCache();
+      activeObjects[i]->commitUpdate();
+    },
+    updateSerial);
+}
+
 void ObjectManager::serialize(const serialization::Serializer<world::World>& ser)
 {
   ser(S_NV("objectCounter", m_objectCounter),
@@ -243,6 +314,11 @@ void ObjectManager::eraseParticle(const std::shared_ptr<Particle>& particle)
   setParent(gsl::not_null{particle}, nullptr);
 }
 
+void ObjectManager::initSpriteParticles(world::World& world)
+{
+  m_spriteParticles = std::make_unique<SpriteParticles>(world);
+}
+
 void ObjectManager::replaceItems(const TR1ItemId& oldId, const TR1ItemId& newId, const world::World& world)
 {
   for(const auto& [_, obj] : m_objects)
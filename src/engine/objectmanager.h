@@ -1,7 +1,9 @@
 #pragma once
 
+#include "raycast.h"
 #include "serialization/serialization_fwd.h"
 
+#include <boost/assert.hpp>
 #include <cstdint>
 #include <gsl/gsl-lite.hpp>
 #include <gslu.h>
@@ -22,6 +24,11 @@ namespace engine::world
 class World;
 }
 
+namespace util
+{
+class WorkerPool;
+}
+
 namespace engine::objects
 {
 class Object;
@@ -32,6 +39,7 @@ namespace engine
 {
 enum class TR1ItemId;
 class Particle;
+struct SpriteParticles;
 
 using ObjectId = uint16_t;
 
@@ -43,38 +51,65 @@ class ObjectManager
   std::list<gslu::nn_shared<objects::Object>> m_activeObjects;
   std::set<gslu::nn_shared<objects::Object>> m_dynamicObjects;
   std::vector<gslu::nn_shared<Particle>> m_particles;
+  std::unique_ptr<SpriteParticles> m_spriteParticles;
   std::shared_ptr<objects::LaraObject> m_lara = nullptr;
+  std::unique_ptr<util::WorkerPool> m_workerPool;
+  mutable LineOfSightCache m_lineOfSightCache;
+  //! @brief Set on a thread while it runs the parallel phase of a split object update, in which objects must not
+  //!        access other objects.
+  static thread_local bool s_inParallelUpdate;
+
+  void updateActiveObjects();
 
 public:
+  ObjectManager();
+  ~ObjectManager();
+
+  [[nodiscard]] auto& getLineOfSightCache() const
+  {
+    return m_lineOfSightCache;
+  }
+
+  void invalidateLineOfSightCache() const
+  {
+    m_lineOfSightCache.clear();
+  }
+
   auto& getObjects()
   {
+    BOOST_ASSERT(!s_inParallelUpdate);
     return m_objects;
   }
 
   [[nodiscard]] const auto& getObjects() const
   {
+    BOOST_ASSERT(!s_inParallelUpdate);
     return m_objects;
   }
 
   [[nodiscard]] const auto& getDynamicObjects() const
   {
+    BOOST_ASSERT(!s_inParallelUpdate);
     return m_dynamicObjects;
   }
 
   objects::LaraObject& getLara()
   {
+    BOOST_ASSERT(!s_inParallelUpdate);
     Expects(m_lara != nullptr);
     return *m_lara;
   }
 
   [[nodiscard]] const auto& getLara() const
   {
+    BOOST_ASSERT(!s_inParallelUpdate);
     Expects(m_lara != nullptr);
     return *m_lara;
   }
 
   [[nodiscard]] const auto& getLaraPtr() const
   {
+    BOOST_ASSERT(!s_inParallelUpdate);
     return m_lara;
   }
 
@@ -110,6 +145,14 @@ public:
 
   void eraseParticle(const std::shared_ptr<Particle>& particle);
 
+  void initSpriteParticles(world::World& world);
+
+  [[nodiscard]] SpriteParticles& getSpriteParticles()
+  {
+    Expects(m_spriteParticles != nullptr);
+    return *m_spriteParticles;
+  }
+
   void applyScheduledDeletions();
   void registerObject(const gslu::nn_shared<objects::Object>& object);
   std::shared_ptr<objects::Object> find(const objects::Object* object, bool includeDynamicObjects = false) const;
@@ -120,7 +120,7 @@ bool AIAgent::animateCreature(const core::Angle& deltaRotationY, const core::Ang
   const auto oldLocation = m_state.location;
 
   const auto boxFloor = m_state.getCurrentBox()->floor;
-  const auto zoneRef = world::Box::getZoneRef(
+  const auto zoneRef = world::BoxZones::getZoneRef(
     getWorld().roomsAreSwapped(), m_creatureInfo->pathFinder.isFlying(), m_creatureInfo->pathFinder.step);
   ModelObject::update();
 
@@ -155,7 +155,7 @@ bool AIAgent::animateCreature(const core::Angle& deltaRotationY, const core::Ang
 
   if(currentSector->box == nullptr || boxFloor - currentSector->box->floor > pathFinder.step
      || boxFloor - currentSector->box->floor < pathFinder.drop
-     || m_state.getCurrentBox().get()->*zoneRef != currentSector->box->*zoneRef)
+     || m_state.getCurrentBox()->zones.*zoneRef != currentSector->box->zones.*zoneRef)
   {
     const auto shoveMin = [this](const core::Length& l)
     {
@@ -532,7 +532,7 @@ bool AIAgent::tryShootAtLara(ModelObject& object,
 
   if(isHit)
   {
-    lara.emitParticle(core::TRVec{}, util::rand15(lara.getSkeleton()->getBoneCount()), &createBloodSplat);
+    lara.emitBloodSplat(core::TRVec{}, util::rand15(lara.getSkeleton()->getBoneCount()));
 
     if(!lara.isInWater())
       lara.playSoundEffect(TR1SoundEffect::BulletHitsLara);
@@ -592,10 +592,10 @@ bool AIAgent::isInsideZoneButNotInBox(const uint32_t zoneId, const world::Box& t
 {
   Expects(m_creatureInfo != nullptr);
 
-  const auto zoneRef = world::Box::getZoneRef(
+  const auto zoneRef = world::BoxZones::getZoneRef(
     getWorld().roomsAreSwapped(), m_creatureInfo->pathFinder.isFlying(), m_creatureInfo->pathFinder.step);
 
-  if(zoneId != targetBox.*zoneRef)
+  if(zoneId != targetBox.zones.*zoneRef)
   {
     return false;
   }
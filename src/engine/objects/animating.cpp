@@ -9,6 +9,14 @@ namespace engine::objects
 {
 void Animating::update()
 {
+  updateParallel();
+  commitUpdate();
+}
+
+void Animating::updateParallel()
+{
+  // runs concurrently with the parallel phases of other objects, so only the object's own state may be accessed here,
+  // which the object manager asserts for its object accessors
   if(m_state.updateActivationTimeout())
   {
     m_state.goal_anim_state = 1_as;
@@ -18,8 +26,13 @@ void Animating::update()
     m_state.goal_anim_state = 0_as;
   }
 
-  ModelObject::update();
-  m_state.location.updateRoom();
-  setCurrentRoom(m_state.location.room);
+  advanceAnimation();
+}
+
+void Animating::commitUpdate()
+{
+  // effects may rotate the object, so they need to be run before it moves
+  runAnimationEffects();
+  applyMovement(false);
 }
 } // namespace engine::objects
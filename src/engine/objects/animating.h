@@ -31,5 +31,13 @@ public:
   MODELOBJECT_DEFAULT_CONSTRUCTORS(Animating, true, true)
 
   void update() override;
+
+  [[nodiscard]] bool isParallelUpdateSafe() const override
+  {
+    return true;
+  }
+
+  void updateParallel() override;
+  void commitUpdate() override;
 };
 } // namespace engine::objects
@@ -42,7 +42,7 @@ void Bat::update()
     case Biting:
       if(touched())
       {
-        emitParticle(core::TRVec{0_len, 16_len, 45_len}, 4, &createBloodSplat);
+        emitBloodSplat(core::TRVec{0_len, 16_len, 45_len}, 4);
         hitLara(2_hp);
       }
       else
@@ -6,21 +6,17 @@
 #include "engine/heightinfo.h"
 #include "engine/location.h"
 #include "engine/objectmanager.h"
-#include "engine/particle.h"
 #include "engine/raycast.h"
+#include "engine/spriteparticles.h"
 #include "engine/world/room.h"
 #include "engine/world/world.h"
 #include "laraobject.h"
 #include "modelobject.h"
 #include "objectstate.h"
 #include "qs/quantity.h"
-#include "render/scene/node.h"
 
 #include <bitset>
-#include <gslu.h>
-#include <memory>
 #include <type_traits>
-#include <utility>
 
 namespace engine::objects
 {
@@ -36,8 +32,8 @@ void Dart::update()
     getWorld().getObjectManager().getLara().m_state.health -= 50_hp;
     getWorld().getObjectManager().getLara().m_state.is_hit = true;
 
-    auto fx = createBloodSplat(getWorld(), m_state.location, m_state.speed, m_state.rotation.Y);
-    getWorld().getObjectManager().registerParticle(fx);
+    getWorld().getObjectManager().getSpriteParticles().bloodSplatter.emit(
+      m_state.location, m_state.speed, m_state.rotation.Y);
   }
 
   const auto oldLocation = m_state.location;
@@ -58,10 +54,6 @@ void Dart::update()
   const auto [success, ricochetPos]
     = raycastLineOfSight(oldLocation, m_state.location.position, getWorld().getObjectManager());
 
-  auto particle = gsl::make_shared<RicochetParticle>(ricochetPos, getWorld());
-  setParent(particle, ricochetPos.room->node);
-  particle->angle = m_state.rotation;
-  particle->timePerSpriteFrame = 6;
-  getWorld().getObjectManager().registerParticle(std::move(particle));
+  getWorld().getObjectManager().getSpriteParticles().ricochet.emit(ricochetPos, 6, m_state.rotation);
 }
 } // namespace engine::objects
@@ -9,20 +9,16 @@
 #include "engine/items_tr1.h"
 #include "engine/location.h"
 #include "engine/objectmanager.h"
-#include "engine/particle.h"
 #include "engine/skeletalmodelnode.h"
 #include "engine/soundeffects_tr1.h"
+#include "engine/spriteparticles.h"
 #include "engine/world/room.h"
 #include "engine/world/world.h"
 #include "modelobject.h"
 #include "objectstate.h"
 #include "qs/quantity.h"
-#include "render/scene/node.h"
 
 #include <gsl/gsl-lite.hpp>
-#include <gslu.h>
-#include <memory>
-#include <utility>
 
 void engine::objects::DartGun::update()
 {
@@ -72,9 +68,7 @@ void engine::objects::DartGun::update()
   auto& dartState = dart->m_state;
   dartState.triggerState = TriggerState::Active;
 
-  auto particle = gsl::make_shared<SmokeParticle>(dartState.location, getWorld(), dartState.rotation);
-  setParent(particle, dartState.location.room->node);
-  getWorld().getObjectManager().registerParticle(std::move(particle));
+  getWorld().getObjectManager().getSpriteParticles().smoke.emit(dartState.location, dartState.rotation);
 
   playSoundEffect(TR1SoundEffect::DartgunShoot);
   ModelObject::update();
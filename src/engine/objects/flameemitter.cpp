@@ -25,8 +25,8 @@ void FlameEmitter::update()
   }
   else if(m_flame != nullptr)
   {
-    removeParticle();
     getWorld().getAudioEngine().stopSoundEffect(TR1SoundEffect::Burning, m_flame.get());
+    removeParticle();
   }
 }
 
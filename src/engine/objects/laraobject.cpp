@@ -19,6 +19,7 @@
 #include "engine/raycast.h"
 #include "engine/skeletalmodelnode.h"
 #include "engine/soundeffects_tr1.h"
+#include "engine/spriteparticles.h"
 #include "engine/world/animation.h"
 #include "engine/world/mesh.h"
 #include "engine/world/rendermeshdata.h"
@@ -381,9 +382,7 @@ void LaraObject::update()
         surfaceLocation.position.Y = *waterSurfaceHeight;
         surfaceLocation.position.Z = m_state.location.position.Z;
 
-        auto particle = gsl::make_shared<SplashParticle>(surfaceLocation, getWorld(), false);
-        setParent(particle, surfaceLocation.room->node);
-        getWorld().getObjectManager().registerParticle(particle);
+        getWorld().getObjectManager().getSpriteParticles().splash.emit(surfaceLocation, false);
       }
     }
   }
@@ -439,9 +438,7 @@ void LaraObject::update()
     auto bubbleCount = util::rand15(2);
     while(bubbleCount-- > 0)
     {
-      auto particle = gsl::make_shared<BubbleParticle>(Location{m_state.location.room, position}, getWorld(), false);
-      setParent(particle, m_state.location.room->node);
-      getWorld().getObjectManager().registerParticle(particle);
+      getWorld().getObjectManager().getSpriteParticles().bubble.emit(Location{m_state.location.room, position}, false);
     }
   }
 
@@ -1326,9 +1323,8 @@ void LaraObject::hitTarget(ModelObject& object, const core::TRVec& hitPos, const
   }
   object.m_state.is_hit = true;
   object.m_state.health -= damage;
-  auto fx = createBloodSplat(
-    getWorld(), Location{object.m_state.location.room, hitPos}, object.m_state.speed, object.m_state.rotation.Y);
-  getWorld().getObjectManager().registerParticle(fx);
+  getWorld().getObjectManager().getSpriteParticles().bloodSplatter.emit(
+    Location{object.m_state.location.room, hitPos}, object.m_state.speed, object.m_state.rotation.Y);
   if(object.m_state.isDead())
     return;
 
@@ -1888,7 +1884,7 @@ void LaraObject::serialize(const serialization::Serializer<world::World>& ser)
 
   if(ser.loading)
   {
-    forceSourcePosition = nullptr;
+    forceSourcePosition.reset();
     getSkeleton()->getRenderState().setScissorTest(false);
   }
 }
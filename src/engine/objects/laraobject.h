@@ -308,7 +308,7 @@ public:
   std::optional<core::Axis> hit_direction;
   core::Frame hit_frame = 0_frame;
   core::Frame explosionStumblingDuration = 0_frame;
-  const core::TRVec* forceSourcePosition = nullptr;
+  std::optional<core::TRVec> forceSourcePosition;
 
   void updateExplosionStumbling();
 
@@ -2,23 +2,17 @@
 
 #include "engine/location.h"
 #include "engine/objectmanager.h"
-#include "engine/particle.h"
 #include "engine/soundeffects_tr1.h"
+#include "engine/spriteparticles.h"
 #include "engine/world/room.h"
 #include "engine/world/world.h"
 #include "objectstate.h"
-#include "render/scene/node.h"
-
-#include <gslu.h>
-#include <memory>
 
 namespace engine::objects
 {
 void LavaParticleEmitter::update()
 {
-  auto particle = gsl::make_shared<LavaParticle>(m_state.location, getWorld());
-  setParent(particle, m_state.location.room->node);
-  getWorld().getObjectManager().registerParticle(particle);
+  getWorld().getObjectManager().getSpriteParticles().lava.emit(m_state.location);
 
   playSoundEffect(TR1SoundEffect::ChoppyWater);
 }
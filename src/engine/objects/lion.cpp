@@ -86,7 +86,7 @@ void Lion::update()
     case 7:
       if(m_state.required_anim_state == 0_as && touched(0x380066UL))
       {
-        emitParticle({-2_len, -10_len, 132_len}, 21, &createBloodSplat);
+        emitBloodSplat({-2_len, -10_len, 132_len}, 21);
         hitLara(250_hp);
         require(1_as);
       }
@@ -11,6 +11,7 @@
 #include "engine/particle.h"
 #include "engine/skeletalmodelnode.h"
 #include "engine/soundeffects_tr1.h"
+#include "engine/spriteparticles.h"
 #include "engine/world/animation.h"
 #include "engine/world/world.h"
 #include "laraobject.h"
@@ -48,6 +49,13 @@ ModelObject::ModelObject(const std::string& name,
 }
 
 void ModelObject::update()
+{
+  advanceAnimation();
+  runAnimationEffects();
+  applyMovement(false);
+}
+
+void ModelObject::advanceAnimation()
 {
   const auto endOfAnim = m_skeleton->advanceFrame(m_state);
 
@@ -97,7 +105,11 @@ void ModelObject::update()
     if(m_state.current_anim_state == m_state.required_anim_state)
       m_state.required_anim_state = 0_as;
   }
+}
 
+void ModelObject::runAnimationEffects()
+{
+  const auto& anim = getSkeleton()->getAnim();
   const auto* cmd = anim->animCommandCount == 0 ? nullptr : anim->animCommands;
   for(uint16_t i = 0; i < anim->animCommandCount; ++i)
   {
@@ -130,8 +142,6 @@ void ModelObject::update()
       break;
     }
   }
-
-  applyMovement(false);
 }
 
 void ModelObject::applyMovement(const bool forLara)
@@ -331,6 +341,21 @@ gslu::nn_shared<Particle> ModelObject::emitParticle(
   gslu::nn_shared<Particle> (*generate)(world::World& world, const Location&, const core::Speed&, const core::Angle&))
 {
   BOOST_ASSERT(generate != nullptr);
+
+  auto particle = generate(getWorld(), getBoneLocation(localPosition, boneIndex), m_state.speed, m_state.rotation.Y);
+  getWorld().getObjectManager().registerParticle(particle);
+
+  return particle;
+}
+
+void ModelObject::emitBloodSplat(const core::TRVec& localPosition, const size_t boneIndex)
+{
+  getWorld().getObjectManager().getSpriteParticles().bloodSplatter.emit(
+    getBoneLocation(localPosition, boneIndex), m_state.speed, m_state.rotation.Y);
+}
+
+Location ModelObject::getBoneLocation(const core::TRVec& localPosition, const size_t boneIndex) const
+{
   BOOST_ASSERT(boneIndex < m_skeleton->getBoneCount());
 
   const auto boneSpheres = m_skeleton->getBoneCollisionSpheres();
@@ -338,10 +363,7 @@ gslu::nn_shared<Particle> ModelObject::emitParticle(
 
   auto location = m_state.location;
   location.position = core::TRVec{boneSpheres.at(boneIndex).relative(localPosition.toRenderSystem())};
-  auto particle = generate(getWorld(), location, m_state.speed, m_state.rotation.Y);
-  getWorld().getObjectManager().registerParticle(particle);
-
-  return particle;
+  return location;
 }
 
 void ModelObject::updateLighting()
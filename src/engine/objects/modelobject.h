@@ -115,6 +115,8 @@ public:
                                                                                const core::Speed& speed,
                                                                                const core::Angle& angle));
 
+  void emitBloodSplat(const core::TRVec& localPosition, size_t boneIndex);
+
   void updateLighting() override;
 
   void collideWithLara(CollisionInfo& collisionInfo, bool push = true);
@@ -128,6 +130,14 @@ public:
 protected:
   std::shared_ptr<SkeletalModelNode> m_skeleton;
   Lighting m_lighting;
+
+  //! @brief Advances the animation, and executes the animation commands only affecting this object
+  void advanceAnimation();
+  //! @brief Plays the sounds and runs the effects of the current animation frame
+  void runAnimationEffects();
+
+private:
+  [[nodiscard]] Location getBoneLocation(const core::TRVec& localPosition, size_t boneIndex) const;
 };
 
 #define MODELOBJECT_DEFAULT_CONSTRUCTORS(CLASS, HAS_UPDATE_FUNCTION, SHADOW_CASTER)             \
@@ -190,7 +190,7 @@ void FlyingMutant::update()
     case DoHit150.get():
       if(m_state.required_anim_state == 0_as && touched(0x678u))
       {
-        emitParticle(core::TRVec{-27_len, 98_len, 0_len}, 10, &createBloodSplat);
+        emitBloodSplat(core::TRVec{-27_len, 98_len, 0_len}, 10);
         hitLara(150_hp);
         require(DoPrepareAttack);
       }
@@ -220,7 +220,7 @@ void FlyingMutant::update()
     case DoHit100.get():
       if(m_state.required_anim_state == 0_as && touched(0x678u))
       {
-        emitParticle(core::TRVec{-27_len, 98_len, 0_len}, 10, &createBloodSplat);
+        emitBloodSplat(core::TRVec{-27_len, 98_len, 0_len}, 10);
         hitLara(100_hp);
         require(DoRun);
       }
@@ -228,7 +228,7 @@ void FlyingMutant::update()
     case DoHit200.get():
       if(m_state.required_anim_state == 0_as && touched(0x678u))
       {
-        emitParticle(core::TRVec{-27_len, 98_len, 0_len}, 10, &createBloodSplat);
+        emitBloodSplat(core::TRVec{-27_len, 98_len, 0_len}, 10);
         hitLara(200_hp);
         require(DoPrepareAttack);
       }
@@ -356,7 +356,7 @@ void CentaurMutant::update()
       {
         if(touched(0x30199u))
         {
-          emitParticle({50_len, 30_len, 0_len}, 5, &createBloodSplat);
+          emitBloodSplat({50_len, 30_len, 0_len}, 5);
           hitLara(200_hp);
           require(1_as);
         }
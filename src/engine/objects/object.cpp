@@ -3,11 +3,12 @@
 #include "engine/audioengine.h"
 #include "engine/engine.h"
 #include "engine/floordata/floordata.h"
+#include "engine/items_tr1.h"
 #include "engine/objectmanager.h"
-#include "engine/particle.h"
 #include "engine/presenter.h"
 #include "engine/script/scriptengine.h"
 #include "engine/soundeffects_tr1.h"
+#include "engine/spriteparticles.h"
 #include "engine/world/room.h"
 #include "engine/world/sector.h"
 #include "engine/world/world.h"
@@ -164,10 +165,9 @@ bool InteractionLimits::canInteract(const ObjectState& objectState, const Object
 
 void Object::emitRicochet(const Location& location)
 {
-  const auto particle = gsl::make_shared<RicochetParticle>(location, getWorld());
-  setParent(particle, m_state.location.room->node);
-  getWorld().getObjectManager().registerParticle(particle);
-  getWorld().getAudioEngine().playSoundEffect(TR1SoundEffect::Ricochet, gsl::not_null{particle.get().get()});
+  auto& ricochet = getWorld().getObjectManager().getSpriteParticles().ricochet;
+  if(const auto particle = ricochet.emit(location))
+    getWorld().getAudioEngine().playSoundEffect(TR1SoundEffect::Ricochet, ricochet.getEmitter(*particle));
 }
 
 std::optional<core::Length> Object::getWaterSurfaceHeight() const
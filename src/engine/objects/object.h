@@ -104,6 +104,26 @@ public:
 
   virtual void update() = 0;
 
+  //! @brief Whether the object supports the split update through updateParallel() and commitUpdate().
+  //! @details Objects returning @c true here are updated by calling updateParallel() concurrently with other such
+  //!          objects directly following them in the update order, followed by commitUpdate() in the regular update
+  //!          order. updateParallel() must only read and modify the object's own state, and must not use the shared
+  //!          random number generator; commitUpdate() must not modify the state of other split update objects. This
+  //!          keeps the results identical to calling update() for all objects serially. The object accessors of the
+  //!          ObjectManager assert that they are not used in updateParallel().
+  [[nodiscard]] virtual bool isParallelUpdateSafe() const
+  {
+    return false;
+  }
+
+  virtual void updateParallel()
+  {
+  }
+
+  virtual void commitUpdate()
+  {
+  }
+
   virtual std::shared_ptr<render::scene::Node> getNode() const = 0;
 
   void setCurrentRoom(const gsl::not_null<const world::Room*>& newRoom);
@@ -89,7 +89,7 @@ void Raptor::update()
         {
           if(touched(0xff7c00UL))
           {
-            emitParticle(core::TRVec{0_len, 66_len, 318_len}, 22, &createBloodSplat);
+            emitBloodSplat(core::TRVec{0_len, 66_len, 318_len}, 22);
             hitLara(100_hp);
             require(1_as);
           }
@@ -102,7 +102,7 @@ void Raptor::update()
       {
         if(touched(0xff7c00UL))
         {
-          emitParticle(core::TRVec{0_len, 66_len, 318_len}, 22, &createBloodSplat);
+          emitBloodSplat(core::TRVec{0_len, 66_len, 318_len}, 22);
           hitLara(100_hp);
           require(3_as);
         }
@@ -112,7 +112,7 @@ void Raptor::update()
       animTilt = animAngle;
       if(m_state.required_anim_state == 0_as && touched(0xff7c00UL))
       {
-        emitParticle(core::TRVec{0_len, 66_len, 318_len}, 22, &createBloodSplat);
+        emitBloodSplat(core::TRVec{0_len, 66_len, 318_len}, 22);
         hitLara(100_hp);
         require(1_as);
       }
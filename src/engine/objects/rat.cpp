@@ -53,7 +53,7 @@ void Rat::update()
         {
           if(touched(0x300018ful))
           {
-            emitParticle({0_len, -11_len, 108_len}, 3, &createBloodSplat);
+            emitBloodSplat({0_len, -11_len, 108_len}, 3);
             hitLara(20_hp);
             require(1_as);
           }
@@ -152,7 +152,7 @@ void Rat::update()
       case 2:
         if(m_state.required_anim_state == 0_as && enemyLocation.enemyAhead && touched(0x300018ful))
         {
-          emitParticle({0_len, -11_len, 108_len}, 3, &createBloodSplat);
+          emitBloodSplat({0_len, -11_len, 108_len}, 3);
           hitLara(20_hp);
           require(3_as);
         }
@@ -168,7 +168,7 @@ void Rat::update()
       case 4:
         if(m_state.required_anim_state == 0_as && enemyLocation.enemyAhead && touched(0x300018ful))
         {
-          emitParticle({0_len, -11_len, 108_len}, 3, &createBloodSplat);
+          emitBloodSplat({0_len, -11_len, 108_len}, 3);
           hitLara(20_hp);
           require(1_as);
         }
@@ -10,8 +10,8 @@
 #include "engine/collisioninfo.h"
 #include "engine/heightinfo.h"
 #include "engine/objectmanager.h"
-#include "engine/particle.h"
 #include "engine/skeletalmodelnode.h"
+#include "engine/spriteparticles.h"
 #include "engine/world/animation.h"
 #include "engine/world/skeletalmodeltype.h"
 #include "engine/world/world.h"
@@ -135,11 +135,8 @@ void RollingBall::collide(CollisionInfo& collisionInfo)
     {
       const auto tmp = lara.m_state.location.position
                        + core::TRVec{util::rand15s(128_len), -util::rand15s(512_len), util::rand15s(128_len)};
-      auto fx = createBloodSplat(getWorld(),
-                                 Location{m_state.location.room, tmp},
-                                 2 * m_state.speed,
-                                 util::rand15s(22.5_deg) + m_state.rotation.Y);
-      getWorld().getObjectManager().registerParticle(fx);
+      getWorld().getObjectManager().getSpriteParticles().bloodSplatter.emit(
+        Location{m_state.location.room, tmp}, 2 * m_state.speed, util::rand15s(22.5_deg) + m_state.rotation.Y);
     }
     return;
   }
@@ -155,15 +152,13 @@ void RollingBall::collide(CollisionInfo& collisionInfo)
   const auto z = lara.m_state.location.position.Z - m_state.location.position.Z;
   const auto xyz = std::max(1_sectors / 2, sqrt(util::square(x) + util::square(y) + util::square(z)));
 
-  auto fx = createBloodSplat(
-    getWorld(),
+  getWorld().getObjectManager().getSpriteParticles().bloodSplatter.emit(
     Location{m_state.location.room,
              core::TRVec{x * 1_sectors / 2 / xyz + m_state.location.position.X,
                          y * 1_sectors / 2 / xyz + m_state.location.position.Y - 2 * core::QuarterSectorSize,
                          z * 1_sectors / 2 / xyz + m_state.location.position.Z}},
     m_state.speed,
     m_state.rotation.Y);
-  getWorld().getObjectManager().registerParticle(fx);
 }
 
 RollingBall::RollingBall(const std::string& name,
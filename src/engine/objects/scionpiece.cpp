@@ -14,11 +14,11 @@
 #include "engine/location.h"
 #include "engine/objectmanager.h"
 #include "engine/objects/spriteobject.h"
-#include "engine/particle.h"
 #include "engine/player.h"
 #include "engine/presenter.h"
 #include "engine/skeletalmodelnode.h"
 #include "engine/soundeffects_tr1.h"
+#include "engine/spriteparticles.h"
 #include "engine/world/animation.h"
 #include "engine/world/room.h"
 #include "engine/world/skeletalmodeltype.h"
@@ -124,11 +124,9 @@ void ScionPiece3::update()
   {
     const auto pos = m_state.location.position
                      + core::TRVec{util::rand15s(512_len), util::rand15s(64_len) - 500_len, util::rand15s(512_len)};
-    const auto particle = gsl::make_shared<ExplosionParticle>(
-      Location{m_state.location.room, pos}, getWorld(), 0_spd, core::TRRotation{});
-    setParent(particle, m_state.location.room->node);
-    getWorld().getObjectManager().registerParticle(particle);
-    getWorld().getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, gsl::not_null{particle.get().get()});
+    auto& explosion = getWorld().getObjectManager().getSpriteParticles().explosion;
+    if(const auto particle = explosion.emit(Location{m_state.location.room, pos}))
+      getWorld().getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, explosion.getEmitter(*particle));
 
     getWorld().getCameraController().setBounce(-200_len);
   }
@@ -5,16 +5,12 @@
 #include "engine/floordata/floordata.h"
 #include "engine/location.h"
 #include "engine/objectmanager.h"
-#include "engine/particle.h"
+#include "engine/spriteparticles.h"
 #include "engine/world/room.h"
 #include "engine/world/world.h"
 #include "laraobject.h"
 #include "objectstate.h"
 #include "qs/quantity.h"
-#include "render/scene/node.h"
-
-#include <gslu.h>
-#include <memory>
 
 namespace engine::objects
 {
@@ -27,8 +23,6 @@ void WaterfallMist::update()
   if(abs(d.X) > 20_sectors || abs(d.Y) > 20_sectors || abs(d.Z) > 20_sectors)
     return;
 
-  auto particle = gsl::make_shared<SplashParticle>(m_state.location, getWorld(), true);
-  setParent(particle, m_state.location.room->node);
-  getWorld().getObjectManager().registerParticle(particle);
+  getWorld().getObjectManager().getSpriteParticles().splash.emit(m_state.location, true);
 }
 } // namespace engine::objects
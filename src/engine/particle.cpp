@@ -16,7 +16,7 @@
 #include "render/scene/mesh.h" // IWYU pragma: keep
 #include "skeletalmodelnode.h"
 #include "soundeffects_tr1.h"
-#include "world/rendermeshdata.h"
+#include "spriteparticles.h"
 #include "world/room.h"
 #include "world/skeletalmodeltype.h"
 #include "world/sprite.h"
@@ -44,11 +44,9 @@ void Particle::initRenderables(world::World& world, bool billboard)
 {
   if(const auto& modelType = world.findAnimatedModelForType(object_number))
   {
-    for(const auto& bone : modelType->bones)
+    for(const auto& mesh : world.getParticleMeshes(gsl::not_null{modelType.get()}))
     {
-      world::RenderMeshDataCompositor compositor;
-      compositor.append(*bone.mesh, gl::SRGBA8{0, 0, 0, 0});
-      m_renderables.emplace_back(compositor.toMesh(*world.getPresenter().getMaterialManager(), false, false, {}));
+      m_renderables.emplace_back(mesh);
     }
   }
   else if(const auto& spriteSequence = world.findSpriteSequenceForType(object_number))
@@ -72,11 +70,6 @@ void Particle::initRenderables(world::World& world, bool billboard)
   }
 }
 
-glm::vec3 Particle::getPosition() const
-{
-  return location.position.toRenderSystem();
-}
-
 Particle::Particle(const std::string& id,
                    const core::TypeId& objectNumber,
                    const gsl::not_null<const world::Room*>& room,
@@ -84,7 +77,6 @@ Particle::Particle(const std::string& id,
                    bool billboard,
                    const std::shared_ptr<render::scene::Renderable>& renderable)
     : Node{id}
-    , Emitter{gsl::not_null{world.getPresenter().getSoundEngine().get()}}
     , location{room}
     , object_number{objectNumber}
 {
@@ -107,7 +99,6 @@ Particle::Particle(const std::string& id,
                    bool billboard,
                    const std::shared_ptr<render::scene::Renderable>& renderable)
     : Node{id}
-    , Emitter{gsl::not_null{world.getPresenter().getSoundEngine().get()}}
     , location{std::move(location)}
     , object_number{objectNumber}
 {
@@ -131,79 +122,9 @@ void Particle::applyTransform()
   setLocalMatrix(translate(glm::mat4{1.0f}, tr) * angle.toMatrix());
 }
 
-bool BloodSplatterParticle::update(world::World& world)
-{
-  location.position += util::pitch(speed * 1_frame, angle.Y);
-  ++timePerSpriteFrame;
-  if(timePerSpriteFrame != 4)
-  {
-    applyTransform();
-    return true;
-  }
-
-  timePerSpriteFrame = 0;
-  nextFrame();
-  if(gsl::narrow<size_t>(-negSpriteFrameId) >= world.findSpriteSequenceForType(object_number)->sprites.size())
-    return false;
-
-  applyTransform();
-  return true;
-}
-
-bool SplashParticle::update(world::World& world)
-{
-  nextFrame();
-
-  if(gsl::narrow<size_t>(-negSpriteFrameId) >= world.findSpriteSequenceForType(object_number)->sprites.size())
-  {
-    return false;
-  }
-
-  location.position += util::pitch(speed * 1_frame, angle.Y);
-
-  applyTransform();
-  return true;
-}
-
-SplashParticle::SplashParticle(const Location& location, world::World& world, const bool waterfall)
-    : Particle{"splash", TR1ItemId::Splash, location, world, false}
-{
-  if(!waterfall)
-  {
-    speed = util::rand15(128_spd);
-    angle.Y = core::auToAngle(2 * util::rand15s());
-  }
-  else
-  {
-    this->location.position.X += util::rand15s(1_sectors);
-    this->location.position.Z += util::rand15s(1_sectors);
-  }
-  getRenderState().setScissorTest(false);
-}
-
-bool BubbleParticle::update(world::World& world)
-{
-  angle.X += 13_deg;
-  angle.Y += 9_deg;
-  location.position += util::pitch(11_len, angle.Y, -speed * 1_frame);
-  auto sector = location.updateRoom();
-  if(m_onlyInWater && !location.room->isWaterRoom)
-  {
-    return false;
-  }
-
-  if(const auto ceiling = HeightInfo::fromCeiling(sector, location.position, world.getObjectManager().getObjects()).y;
-     ceiling == core::InvalidHeight || location.position.Y <= ceiling)
-  {
-    return false;
-  }
-
-  applyTransform();
-  return true;
-}
-
 FlameParticle::FlameParticle(const Location& location, world::World& world, bool randomize)
     : Particle{"flame", TR1ItemId::Flame, location, world, false}
+    , Emitter{gsl::not_null{world.getPresenter().getSoundEngine().get()}}
 {
   timePerSpriteFrame = 0;
   negSpriteFrameId = 0;
@@ -295,6 +216,11 @@ bool FlameParticle::update(world::World& world)
   return true;
 }
 
+glm::vec3 FlameParticle::getPosition() const
+{
+  return location.position.toRenderSystem();
+}
+
 bool MeshShrapnelParticle::update(world::World& world)
 {
   angle.X += 5_deg;
@@ -331,7 +257,7 @@ bool MeshShrapnelParticle::update(world::World& world)
     lara.m_state.health -= m_damageRadius * 1_hp / 1_len;
     explode = true;
 
-    lara.forceSourcePosition = &location.position;
+    lara.forceSourcePosition = location.position;
     lara.explosionStumblingDuration = 5_frame;
   }
 
@@ -341,10 +267,9 @@ bool MeshShrapnelParticle::update(world::World& world)
   if(!explode)
     return true;
 
-  const auto particle = gsl::make_shared<ExplosionParticle>(location, world, fall_speed, angle);
-  setParent(particle, location.room->node);
-  world.getObjectManager().registerParticle(particle);
-  world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, particle.get().get());
+  auto& explosion = world.getObjectManager().getSpriteParticles().explosion;
+  if(const auto particle = explosion.emit(location, angle))
+    world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, explosion.getEmitter(*particle));
   return false;
 }
 
@@ -386,21 +311,18 @@ bool MutantBulletParticle::update(world::World& world)
      || HeightInfo::fromCeiling(sector, location.position, world.getObjectManager().getObjects()).y
           >= location.position.Y)
   {
-    auto particle = gsl::make_shared<RicochetParticle>(location, world);
-    particle->timePerSpriteFrame = 6;
-    setParent(particle, location.room->node);
-    world.getObjectManager().registerParticle(particle);
-    world.getAudioEngine().playSoundEffect(TR1SoundEffect::Ricochet, particle.get().get());
+    auto& ricochet = world.getObjectManager().getSpriteParticles().ricochet;
+    if(const auto particle = ricochet.emit(location, 6))
+      world.getAudioEngine().playSoundEffect(TR1SoundEffect::Ricochet, ricochet.getEmitter(*particle));
     return false;
   }
   else if(world.getObjectManager().getLara().isNearInexact(location.position, 200_len))
   {
     auto& laraState = world.getObjectManager().getLara().m_state;
     laraState.health -= 30_hp;
-    auto particle = gsl::make_shared<BloodSplatterParticle>(location, speed, angle.Y, world);
-    setParent(particle, location.room->node);
-    world.getObjectManager().registerParticle(particle);
-    world.getAudioEngine().playSoundEffect(TR1SoundEffect::BulletHitsLara, particle.get().get());
+    auto& bloodSplatter = world.getObjectManager().getSpriteParticles().bloodSplatter;
+    if(const auto particle = bloodSplatter.emit(location, speed, angle.Y))
+      world.getAudioEngine().playSoundEffect(TR1SoundEffect::BulletHitsLara, bloodSplatter.getEmitter(*particle));
     laraState.is_hit = true;
     angle.Y = laraState.rotation.Y;
     speed = laraState.speed;
@@ -422,10 +344,9 @@ bool MutantGrenadeParticle::update(world::World& world)
      || HeightInfo::fromCeiling(sector, location.position, world.getObjectManager().getObjects()).y
           >= location.position.Y)
   {
-    auto particle = gsl::make_shared<ExplosionParticle>(location, world, fall_speed, angle);
-    setParent(particle, location.room->node);
-    world.getObjectManager().registerParticle(particle);
-    world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, particle.get().get());
+    auto& explosion = world.getObjectManager().getSpriteParticles().explosion;
+    if(const auto particle = explosion.emit(location, angle))
+      world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, explosion.getEmitter(*particle));
 
     const auto dd = location.position - world.getObjectManager().getLara().m_state.location.position;
     const auto d = util::square(dd.X) + util::square(dd.Y) + util::square(dd.Z);
@@ -441,15 +362,14 @@ bool MutantGrenadeParticle::update(world::World& world)
   else if(world.getObjectManager().getLara().isNearInexact(location.position, 200_len))
   {
     world.getObjectManager().getLara().m_state.health -= 100_hp;
-    auto particle = gsl::make_shared<ExplosionParticle>(location, world, fall_speed, angle);
-    setParent(particle, location.room->node);
-    world.getObjectManager().registerParticle(particle);
-    world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, particle.get().get());
+    auto& explosion = world.getObjectManager().getSpriteParticles().explosion;
+    if(const auto particle = explosion.emit(location, angle))
+      world.getAudioEngine().playSoundEffect(TR1SoundEffect::Explosion2, explosion.getEmitter(*particle));
 
     if(!world.getObjectManager().getLara().isDead())
     {
       world.getObjectManager().getLara().playSoundEffect(TR1SoundEffect::LaraHurt);
-      world.getObjectManager().getLara().forceSourcePosition = &particle->location.position;
+      world.getObjectManager().getLara().forceSourcePosition = location.position;
       world.getObjectManager().getLara().explosionStumblingDuration = 5_frame;
     }
 
@@ -465,44 +385,6 @@ bool MutantGrenadeParticle::update(world::World& world)
   return true;
 }
 
-bool LavaParticle::update(world::World& world)
-{
-  fall_speed += core::Gravity * 1_frame;
-  location.position += util::pitch(speed * 1_frame, angle.Y, fall_speed * 1_frame);
-
-  const auto sector = location.updateRoom();
-  setParent(this, location.room->node);
-  if(HeightInfo::fromFloor(sector, location.position, world.getObjectManager().getObjects()).y <= location.position.Y
-     || HeightInfo::fromCeiling(sector, location.position, world.getObjectManager().getObjects()).y
-          > location.position.Y)
-  {
-    return false;
-  }
-
-  if(world.getObjectManager().getLara().isNearInexact(location.position, 200_len))
-  {
-    world.getObjectManager().getLara().m_state.health -= 10_hp;
-    world.getObjectManager().getLara().m_state.is_hit = true;
-    return false;
-  }
-
-  applyTransform();
-  return true;
-}
-
-bool SparkleParticle::update(world::World&)
-{
-  applyTransform();
-
-  ++timePerSpriteFrame;
-  if(timePerSpriteFrame != 1)
-    return true;
-
-  --negSpriteFrameId;
-  timePerSpriteFrame = 0;
-  return gsl::narrow<size_t>(-negSpriteFrameId) < getLength();
-}
-
 bool MuzzleFlashParticle::update(world::World&)
 {
   --timePerSpriteFrame;
@@ -514,44 +396,6 @@ bool MuzzleFlashParticle::update(world::World&)
   return true;
 }
 
-bool ExplosionParticle::update(world::World&)
-{
-  ++timePerSpriteFrame;
-  if(timePerSpriteFrame == 2)
-  {
-    timePerSpriteFrame = 0;
-    nextFrame();
-    if(static_cast<size_t>(-negSpriteFrameId) >= getLength())
-    {
-      return false;
-    }
-  }
-
-  applyTransform();
-  return true;
-}
-
-bool SmokeParticle::update(world::World&)
-{
-  applyTransform();
-
-  ++timePerSpriteFrame;
-  if(timePerSpriteFrame < 3)
-    return true;
-
-  timePerSpriteFrame = 0;
-  nextFrame();
-  return gsl::narrow<size_t>(-negSpriteFrameId) < getLength();
-}
-
-bool RicochetParticle::update(world::World&)
-{
-  applyTransform();
-
-  --timePerSpriteFrame;
-  return timePerSpriteFrame != 0;
-}
-
 gslu::nn_shared<Particle> createMuzzleFlash(world::World& world,
                                             const Location& location,
                                             const core::Speed& /*speed*/,
@@ -582,11 +426,4 @@ gslu::nn_shared<Particle> createMutantGrenade(world::World& world,
   return particle;
 }
 
-gslu::nn_shared<Particle>
-  createBloodSplat(world::World& world, const Location& location, const core::Speed& speed, const core::Angle& angle)
-{
-  auto particle = gsl::make_shared<BloodSplatterParticle>(location, speed, angle, world);
-  setParent(particle, location.room->node);
-  return particle;
-}
 } // namespace engine
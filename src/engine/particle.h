@@ -35,9 +35,7 @@ struct Room;
 
 namespace engine
 {
-class Particle
-    : public render::scene::Node
-    , public audio::Emitter
+class Particle : public render::scene::Node
 {
 public:
   Location location;
@@ -101,79 +99,6 @@ public:
   }
 
   virtual bool update(world::World& world) = 0;
-
-  glm::vec3 getPosition() const final;
-};
-
-class BloodSplatterParticle final : public Particle
-{
-public:
-  explicit BloodSplatterParticle(const Location& location,
-                                 const core::Speed& speed_,
-                                 const core::Angle& angle_,
-                                 world::World& world)
-      : Particle{"bloodsplat", TR1ItemId::Blood, location, world, true}
-  {
-    speed = speed_;
-    angle.Y = angle_;
-  }
-
-  bool update(world::World& world) override;
-};
-
-class SplashParticle final : public Particle
-{
-public:
-  explicit SplashParticle(const Location& location, world::World& world, bool waterfall);
-
-  bool update(world::World& world) override;
-};
-
-class RicochetParticle final : public Particle
-{
-public:
-  explicit RicochetParticle(const Location& location, world::World& world)
-      : Particle{"ricochet", TR1ItemId::Ricochet, location, world, false}
-  {
-    timePerSpriteFrame = 4;
-
-    const int n = util::rand15(3);
-    for(int i = 0; i < n; ++i)
-      nextFrame();
-  }
-
-  bool update(world::World& /*world*/) override;
-};
-
-class BubbleParticle final : public Particle
-{
-public:
-  explicit BubbleParticle(const Location& location, world::World& world, bool onlyInWater = true)
-      : Particle{"bubble", TR1ItemId::Bubbles, location, world, true, nullptr}
-      , m_onlyInWater{onlyInWater}
-  {
-    speed = 10_spd + util::rand15(6_spd);
-
-    const int n = util::rand15(3);
-    for(int i = 0; i < n; ++i)
-      nextFrame();
-  }
-
-  bool update(world::World& world) override;
-
-private:
-  const bool m_onlyInWater;
-};
-
-class SparkleParticle final : public Particle
-{
-public:
-  explicit SparkleParticle(const Location& location, world::World& world)
-      : Particle{"sparkles", TR1ItemId::Sparkles, location, world, true}
-  {
-  }
-
-  bool update(world::World& /*world*/) override;
 };
 
 class MuzzleFlashParticle final : public Particle
@@ -190,28 +115,16 @@ public:
   bool update(world::World& /*world*/) override;
 };
 
-class FlameParticle final : public Particle
+class FlameParticle final
+    : public Particle
+    , public audio::Emitter
 {
 public:
   explicit FlameParticle(const Location& location, world::World& world, bool randomize = false);
 
   bool update(world::World& world) override;
-};
-
-class ExplosionParticle final : public Particle
-{
-public:
-  explicit ExplosionParticle(const Location& location,
-                             world::World& world,
-                             const core::Speed& fallSpeed,
-                             const core::TRRotation& angle)
-      : Particle{"explosion", TR1ItemId::Explosion, location, world, true}
-  {
-    fall_speed = fallSpeed;
-    this->angle = angle;
-  }
 
-  bool update(world::World& /*world*/) override;
+  glm::vec3 getPosition() const override;
 };
 
 class MeshShrapnelParticle final : public Particle
@@ -269,36 +182,6 @@ public:
   bool update(world::World& world) override;
 };
 
-class LavaParticle final : public Particle
-{
-public:
-  explicit LavaParticle(const Location& location, world::World& world)
-      : Particle{"lava", TR1ItemId::LavaParticles, location, world, true}
-  {
-    angle.Y = util::rand15(180_deg) * 2;
-    speed = util::rand15(32_spd);
-    fall_speed = -util::rand15(165_spd);
-    negSpriteFrameId = util::rand15(int16_t{-4});
-  }
-
-  bool update(world::World& world) override;
-};
-
-class SmokeParticle final : public Particle
-{
-public:
-  explicit SmokeParticle(const Location& location, world::World& world, const core::TRRotation& rotation)
-      : Particle{"smoke", TR1ItemId::Smoke, location, world, false}
-  {
-    angle = rotation;
-  }
-
-  bool update(world::World& /*world*/) override;
-};
-
-extern gslu::nn_shared<Particle>
-  createBloodSplat(world::World& world, const Location& location, const core::Speed& speed, const core::Angle& angle);
-
 extern gslu::nn_shared<Particle> createMuzzleFlash(world::World& world,
                                                    const Location& location,
                                                    const core::Speed& /*speed*/,
@@ -0,0 +1,22 @@
+#include "posecache.h"
+
+namespace engine
+{
+std::shared_ptr<const PoseCache::Pose> PoseCache::find(const Key& key) const
+{
+  std::lock_guard lock{m_mutex};
+  const auto it = m_poses.find(key);
+  return it == m_poses.end() ? nullptr : it->second;
+}
+
+void PoseCache::insert(const Key& key, const std::shared_ptr<const Pose>& pose)
+{
+  std::lock_guard lock{m_mutex};
+  if(m_poses.size() >= MaxEntries)
+  {
+    // poses are cheap to re-create, so a simple flush is good enough to keep the memory bounded
+    m_poses.clear();
+  }
+  m_poses.emplace(key, pose);
+}
+} // namespace engine
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <glm/mat4x4.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace loader::file
+{
+struct AnimFrame;
+}
+
+namespace engine
+{
+//! @brief Interpolated bone poses of a skeletal model, shared by all instances of the model.
+//! @details Only contains poses without any bone patches applied. Safe to be used from multiple threads.
+class PoseCache final
+{
+public:
+  //! @brief First and second keyframe, and the interpolation bias between them
+  using Key = std::tuple<const loader::file::AnimFrame*, const loader::file::AnimFrame*, float>;
+  using Pose = std::vector<glm::mat4>;
+
+  [[nodiscard]] std::shared_ptr<const Pose> find(const Key& key) const;
+  void insert(const Key& key, const std::shared_ptr<const Pose>& pose);
+
+private:
+  static constexpr size_t MaxEntries = 256;
+
+  mutable std::mutex m_mutex;
+  std::map<Key, std::shared_ptr<const Pose>> m_poses;
+};
+} // namespace engine
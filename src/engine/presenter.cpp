@@ -10,11 +10,13 @@
 #include "objects/laraobject.h"
 #include "objects/objectstate.h"
 #include "qs/qs.h"
+#include "render/dynamicresolution.h"
 #include "render/pass/config.h"
 #include "render/renderpipeline.h"
 #include "render/rendersettings.h"
 #include "render/scene/camera.h"
 #include "render/scene/csm.h"
+#include "render/scene/hizbuffer.h"
 #include "render/scene/material.h"
 #include "render/scene/materialgroup.h"
 #include "render/scene/materialmanager.h"
@@ -51,9 +53,11 @@
 #include <gl/texture2d.h>
 #include <gl/texturedepth.h>
 #include <gl/texturehandle.h>
+#include <gl/timerquery.h>
 #include <gl/window.h>
 #include <glm/common.hpp>
 #include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
 #include <gslu.h>
@@ -72,6 +76,9 @@ constexpr auto HealthPulseDurationSlow = 3_sec * core::FrameRate;
 constexpr auto HealthPulseDurationFast = 1_sec * core::FrameRate / 2;
 constexpr auto HealthPulseMinHealth = core::LaraHealth / 5;
 constexpr auto HealthPulseMaxHealth = core::LaraHealth / 2;
+
+// leave some headroom below 60 FPS so that short spikes don't drop frames
+constexpr float DynamicResolutionTargetFrameTimeMs = 1000.0f / 60 * 0.9f;
 } // namespace
 
 namespace engine
@@ -124,6 +131,9 @@ void Presenter::renderWorld(const std::vector<world::Room>& rooms,
                             const CameraController& cameraController,
                             const std::unordered_set<const world::Portal*>& waterEntryPortals)
 {
+  if(m_frameTimer != nullptr)
+    m_frameTimer->begin();
+
   m_renderPipeline->updateCamera(m_renderer->getCamera());
 
   {
@@ -132,13 +142,17 @@ void Presenter::renderWorld(const std::vector<world::Room>& rooms,
     gl::RenderState::getWantedState().setDepthClamp(true);
     m_csm->updateCamera(*m_renderer->getCamera());
 
-    for(const auto& texture : m_csm->getDepthTextures())
-      texture->clear(gl::ScalarDepth{1.0f});
+    // splits that do not need an update keep their shadow maps from previous frames
+    const auto depthTextures = m_csm->getDepthTextures();
     for(size_t i = 0; i < render::scene::CSMBuffer::NSplits; ++i)
     {
+      m_csm->setActiveSplit(i);
+      if(!m_csm->activeSplitNeedsUpdate())
+        continue;
+
       SOGLB_DEBUGGROUP("csm-pass/" + std::to_string(i));
 
-      m_csm->setActiveSplit(i);
+      depthTextures[i]->clear(gl::ScalarDepth{1.0f});
       m_csm->getActiveFramebuffer()->bind();
       gl::RenderState::getWantedState() = m_csm->getActiveFramebuffer()->getRenderState();
 
@@ -164,8 +178,11 @@ void Presenter::renderWorld(const std::vector<world::Room>& rooms,
 
     for(size_t i = 0; i < render::scene::CSMBuffer::NSplits; ++i)
     {
-      SOGLB_DEBUGGROUP("csm-pass-square/" + std::to_string(i));
       m_csm->setActiveSplit(i);
+      if(!m_csm->activeSplitNeedsUpdate())
+        continue;
+
+      SOGLB_DEBUGGROUP("csm-pass-square/" + std::to_string(i));
       m_csm->waitActiveDepthSync();
       m_csm->renderSquare();
       m_csm->beginActiveSquareSync();
@@ -176,8 +193,11 @@ void Presenter::renderWorld(const std::vector<world::Room>& rooms,
 
     for(size_t i = 0; i < render::scene::CSMBuffer::NSplits; ++i)
     {
-      SOGLB_DEBUGGROUP("csm-pass-blur/" + std::to_string(i));
       m_csm->setActiveSplit(i);
+      if(!m_csm->activeSplitNeedsUpdate())
+        continue;
+
+      SOGLB_DEBUGGROUP("csm-pass-blur/" + std::to_string(i));
       m_csm->waitActiveSquareSync();
       m_csm->renderBlur();
       m_csm->beginActiveBlurSync();
@@ -189,7 +209,8 @@ void Presenter::renderWorld(const std::vector<world::Room>& rooms,
     for(size_t i = 0; i < render::scene::CSMBuffer::NSplits; ++i)
     {
       m_csm->setActiveSplit(i);
-      m_csm->waitActiveBlurSync();
+      if(m_csm->activeSplitNeedsUpdate())
+        m_csm->waitActiveBlurSync();
     }
   }
 
@@ -231,7 +252,16 @@ void Presenter::renderWorld(const std::vector<world::Room>& rooms,
         GL_ASSERT(gl::api::finish());
     }
 
-    m_renderer->render();
+    if(m_occlusionCulling)
+    {
+      // the prefilled room geometry occludes everything else
+      m_renderPipeline->updateHiZBuffer(cameraController.getCamera()->getViewProjectionMatrix());
+      m_renderer->render(&m_renderPipeline->getHiZBuffer());
+    }
+    else
+    {
+      m_renderer->render();
+    }
 
     if constexpr(render::pass::FlushPasses)
       GL_ASSERT(gl::api::finish());
@@ -414,7 +444,9 @@ std::vector<std::filesystem::path> getIconPaths(const std::filesystem::path& bas
 }
 } // namespace
 
-Presenter::Presenter(const std::filesystem::path& engineDataPath, const glm::ivec2& resolution)
+Presenter::Presenter(const std::filesystem::path& engineDataPath,
+                     const std::filesystem::path& userDataPath,
+                     const glm::ivec2& resolution)
     : m_window{std::make_unique<gl::Window>(getIconPaths(engineDataPath, {24, 32, 64, 128, 256, 512}), resolution)}
     , m_soundEngine{std::make_shared<audio::SoundEngine>()}
     , m_renderer{std::make_shared<render::scene::Renderer>(
@@ -426,7 +458,7 @@ Presenter::Presenter(const std::filesystem::path& engineDataPath, const glm::ive
     , m_debugFont{std::make_unique<gl::Font>(util::ensureFileExists(engineDataPath / "DroidSansMono.ttf"))}
     , m_inputHandler{std::make_unique<hid::InputHandler>(m_window->getWindow(),
                                                          engineDataPath / "gamecontrollerdb.txt")}
-    , m_shaderCache{std::make_shared<render::scene::ShaderCache>(engineDataPath / "shaders")}
+    , m_shaderCache{std::make_shared<render::scene::ShaderCache>(engineDataPath / "shaders", userDataPath / "shadercache")}
     , m_materialManager{std::make_unique<render::scene::MaterialManager>(m_shaderCache, m_renderer)}
     , m_csm{std::make_shared<render::scene::CSM>(1024, *m_materialManager)}
     , m_renderPipeline{std::make_unique<render::RenderPipeline>(
@@ -497,8 +529,16 @@ bool Presenter::preFrame()
   if(m_window->isMinimized())
     return false;
 
+  if(m_dynamicResolution != nullptr)
+  {
+    if(const auto elapsed = m_frameTimer->poll(); elapsed.has_value())
+      m_dynamicResolution->addFrameTime(static_cast<float>(*elapsed) / 1e6f);
+  }
+
   m_renderer->getCamera()->setViewport(getRenderViewport());
-  m_renderPipeline->resize(*m_materialManager, getRenderViewport(), getUiViewport(), getDisplayViewport());
+  // the targets are allocated for the largest scale, so that a scale change only changes the rendered region
+  m_renderPipeline->resize(*m_materialManager, getMaxRenderViewport(), getUiViewport(), getDisplayViewport());
+  m_renderPipeline->setRenderRegion(getRenderViewport());
   if(m_screenOverlay != nullptr)
   {
     if(m_screenOverlay->getImage()->getSize() != getDisplayViewport())
@@ -533,6 +573,8 @@ void Presenter::setTrFont(std::unique_ptr<ui::TRFont>&& font)
 void Presenter::swapBuffers()
 {
   m_renderPipeline->renderBackbufferEffects();
+  if(m_frameTimer != nullptr)
+    m_frameTimer->end();
   m_window->swapBuffers();
 }
 
@@ -552,6 +594,31 @@ void Presenter::apply(const render::RenderSettings& renderSettings, const AudioS
 {
   m_renderResolutionDivisor = renderSettings.renderResolutionDivisorActive ? renderSettings.renderResolutionDivisor : 1;
   m_uiScale = renderSettings.uiScaleActive ? renderSettings.uiScaleMultiplier : 1;
+  m_occlusionCulling = renderSettings.occlusionCulling;
+  if(!renderSettings.dynamicResolution)
+  {
+    m_dynamicResolution.reset();
+    m_frameTimer.reset();
+  }
+  else
+  {
+    const auto toScale = [](uint8_t percent)
+    {
+      return static_cast<float>(std::clamp<uint8_t>(percent, 10, 100)) / 100;
+    };
+    const auto minScale = toScale(renderSettings.dynamicResolutionMinPercent);
+    const auto maxScale = std::max(minScale, toScale(renderSettings.dynamicResolutionMaxPercent));
+    if(m_dynamicResolution == nullptr)
+    {
+      m_dynamicResolution
+        = std::make_unique<render::DynamicResolution>(minScale, maxScale, DynamicResolutionTargetFrameTimeMs);
+      m_frameTimer = std::make_unique<gl::TimerQuery>();
+    }
+    else
+    {
+      m_dynamicResolution->setBounds(minScale, maxScale);
+    }
+  }
   m_renderer->getCamera()->setViewport(getRenderViewport());
   setFullscreen(renderSettings.fullscreen);
   if(m_csm->getResolution() != renderSettings.getCSMResolution())
@@ -560,6 +627,8 @@ void Presenter::apply(const render::RenderSettings& renderSettings, const AudioS
     m_materialManager->setCSM(m_csm);
   }
   m_renderPipeline->apply(renderSettings, *m_materialManager);
+  if(renderSettings.shaderWarmUp)
+    m_materialManager->warmUp(renderSettings);
   m_materialManager->setFiltering(renderSettings.bilinearFiltering,
                                   !renderSettings.anisotropyActive
                                     ? std::nullopt
@@ -613,16 +682,34 @@ void Presenter::updateSoundEngine()
   m_soundEngine->update();
 }
 
-glm::ivec2 Presenter::getRenderViewport() const
+glm::ivec2 Presenter::getStaticRenderViewport() const
 {
   BOOST_ASSERT(m_renderResolutionDivisor > 0);
   return m_window->getViewport() / static_cast<int>(m_renderResolutionDivisor);
 }
 
+glm::ivec2 Presenter::getRenderViewport() const
+{
+  if(m_dynamicResolution == nullptr)
+    return getStaticRenderViewport();
+
+  return glm::max(glm::ivec2{glm::vec2{getStaticRenderViewport()} * m_dynamicResolution->getScale()}, glm::ivec2{1});
+}
+
+glm::ivec2 Presenter::getMaxRenderViewport() const
+{
+  if(m_dynamicResolution == nullptr)
+    return getStaticRenderViewport();
+
+  return glm::max(glm::ivec2{glm::vec2{getStaticRenderViewport()} * m_dynamicResolution->getMaxScale()},
+                  glm::ivec2{1});
+}
+
 glm::ivec2 Presenter::getUiViewport() const
 {
+  // the ui must not change its size with the dynamic render scale
   BOOST_ASSERT(m_uiScale > 0);
-  return getRenderViewport() / static_cast<int>(m_uiScale);
+  return getStaticRenderViewport() / static_cast<int>(m_uiScale);
 }
 
 void Presenter::bindBackbuffer()
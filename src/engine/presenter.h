@@ -37,6 +37,7 @@ class InputHandler;
 
 namespace render
 {
+class DynamicResolution;
 class RenderPipeline;
 struct RenderSettings;
 } // namespace render
@@ -71,7 +72,9 @@ public:
   static const constexpr float DefaultFov = glm::radians(60.0f);
   static const constexpr core::Frame DefaultHealthBarTimeout = core::FrameRate * 1_sec * 4 / 3;
 
-  explicit Presenter(const std::filesystem::path& engineDataPath, const glm::ivec2& resolution);
+  explicit Presenter(const std::filesystem::path& engineDataPath,
+                     const std::filesystem::path& userDataPath,
+                     const glm::ivec2& resolution);
   ~Presenter();
 
   void playVideo(const std::filesystem::path& path);
@@ -176,6 +179,7 @@ private:
   const std::unique_ptr<gl::Window> m_window;
   uint8_t m_renderResolutionDivisor = 1;
   uint8_t m_uiScale = 1;
+  bool m_occlusionCulling = true;
 
   std::shared_ptr<audio::SoundEngine> m_soundEngine;
   const gslu::nn_shared<render::scene::Renderer> m_renderer;
@@ -195,9 +199,15 @@ private:
 
   const gslu::nn_unique<render::RenderPipeline> m_renderPipeline;
   std::unique_ptr<render::scene::ScreenOverlay> m_screenOverlay;
+  std::unique_ptr<render::DynamicResolution> m_dynamicResolution;
+  //! @brief Measures the GPU time of the world rendering while the dynamic resolution is active.
+  std::unique_ptr<gl::TimerQuery> m_frameTimer;
 
   bool m_renderSettingsChanged = false;
 
   void scaleSplashImage();
+  [[nodiscard]] glm::ivec2 getStaticRenderViewport() const;
+  //! @brief The largest render viewport the dynamic resolution may use.
+  [[nodiscard]] glm::ivec2 getMaxRenderViewport() const;
 };
 } // namespace engine
@@ -125,11 +125,33 @@ std::pair<CollisionType, Location> clampSteps(const Location& start,
   }
 }
 
+// only a handful of distinct queries are made between two invalidations, so a linear search is sufficient
+constexpr size_t MaxLineOfSightCacheEntries = 32;
 } // namespace
 
+const std::pair<bool, Location>* LineOfSightCache::find(const Location& start, const core::TRVec& goal) const
+{
+  for(const auto& entry : m_entries)
+  {
+    if(entry.start.room == start.room && entry.start.position == start.position && entry.goal == goal)
+      return &entry.result;
+  }
+  return nullptr;
+}
+
+void LineOfSightCache::insert(const Location& start, const core::TRVec& goal, const std::pair<bool, Location>& result)
+{
+  if(m_entries.size() >= MaxLineOfSightCacheEntries)
+    m_entries.clear();
+  m_entries.emplace_back(Entry{start, goal, result});
+}
+
 std::pair<bool, Location>
   raycastLineOfSight(const Location& start, const core::TRVec& goal, const ObjectManager& objectManager)
 {
+  if(const auto cached = objectManager.getLineOfSightCache().find(start, goal))
+    return *cached;
+
   auto collide = [&start, &goal, &objectManager](
                    core::Length(core::TRVec::*firstStepAxis),
                    core::Length(core::TRVec::*secondStepAxis)) -> std::tuple<CollisionType, CollisionType, Location>
@@ -151,15 +173,26 @@ std::pair<bool, Location>
 
   if(secondCollision == CollisionType::Wall)
   {
+    objectManager.getLineOfSightCache().insert(start, goal, {false, result});
     return {false, result};
   }
 
+  const auto unclamped = result;
   bool success = clampY(start.position, result, objectManager) && firstCollision == CollisionType::None
                  && secondCollision == CollisionType::None;
-  // redo raycasting to properly calculate the correct room, possibly fixes EE-432
-  result = abs(result.position.Z - start.position.Z) <= abs(result.position.X - start.position.X)
-             ? std::get<2>(collide(&core::TRVec::Z, &core::TRVec::X))
-             : std::get<2>(collide(&core::TRVec::X, &core::TRVec::Z));
+  if(unclamped.position == goal && result.position == goal)
+  {
+    // redoing the raycast would repeat the exact same traversal
+    result = unclamped;
+  }
+  else
+  {
+    // redo raycasting to properly calculate the correct room, possibly fixes EE-432
+    result = abs(result.position.Z - start.position.Z) <= abs(result.position.X - start.position.X)
+               ? std::get<2>(collide(&core::TRVec::Z, &core::TRVec::X))
+               : std::get<2>(collide(&core::TRVec::X, &core::TRVec::Z));
+  }
+  objectManager.getLineOfSightCache().insert(start, goal, {success, result});
   return {success, result};
 }
 } // namespace engine
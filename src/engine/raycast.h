@@ -1,13 +1,38 @@
 #pragma once
 
 #include "core/vec.h"
+#include "location.h"
 
 #include <utility>
+#include <vector>
 
 namespace engine
 {
 class ObjectManager;
-struct Location;
+
+//! @brief Memoizes line of sight results as long as the world state they depend on does not change
+//! @note Must be invalidated whenever objects may have changed the floor or ceiling heights, or the rooms were swapped.
+class LineOfSightCache final
+{
+public:
+  [[nodiscard]] const std::pair<bool, Location>* find(const Location& start, const core::TRVec& goal) const;
+  void insert(const Location& start, const core::TRVec& goal, const std::pair<bool, Location>& result);
+
+  void clear()
+  {
+    m_entries.clear();
+  }
+
+private:
+  struct Entry
+  {
+    Location start;
+    core::TRVec goal;
+    std::pair<bool, Location> result;
+  };
+
+  std::vector<Entry> m_entries;
+};
 
 extern std::pair<bool, Location>
   raycastLineOfSight(const Location& start, const core::TRVec& goal, const ObjectManager& objectManager);
@@ -18,6 +18,7 @@
 #include "serialization/skeletalmodeltype_ptr.h"
 #include "serialization/vector.h"
 #include "serialization/vector_element.h"
+#include "skinnedmeshcache.h"
 #include "util/helpers.h"
 #include "world/animation.h"
 #include "world/rendermeshdata.h"
@@ -26,16 +27,27 @@
 #include "world/world.h"
 
 #include <boost/assert.hpp>
+#include <cstdint>
 #include <exception>
 #include <glm/common.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/vec2.hpp>
 #include <initializer_list>
+#include <limits>
 #include <stack>
 #include <utility>
 
 namespace engine
 {
+namespace
+{
+[[nodiscard]] uint32_t packReflective(const gl::SRGBA8& reflective)
+{
+  const auto& c = reflective.channels;
+  return (uint32_t{c.r} << 24u) | (uint32_t{c.g} << 16u) | (uint32_t{c.b} << 8u) | uint32_t{c.a};
+}
+} // namespace
+
 SkeletalModelNode::SkeletalModelNode(const std::string& id,
                                      gsl::not_null<const world::World*> world,
                                      gsl::not_null<const world::SkeletalModelType*> model,
@@ -93,16 +105,60 @@ void SkeletalModelNode::updatePose()
 
   BOOST_ASSERT(m_meshParts.size() >= m_model->bones.size());
 
-  updatePose(getInterpolationInfo());
+  const auto framePair = getInterpolationInfo();
+  m_pendingPoseKey = PoseCache::Key{framePair.firstFrame.get(), framePair.secondFrame.get(), framePair.bias};
+}
+
+void SkeletalModelNode::ensurePose() const
+{
+  if(!m_pendingPoseKey.has_value())
+    return;
+
+  const auto [firstFrame, secondFrame, bias] = *m_pendingPoseKey;
+  m_pendingPoseKey.reset();
+  updatePose(InterpolationInfo{gsl::not_null{firstFrame}, gsl::not_null{secondFrame}, bias});
 }
 
-void SkeletalModelNode::updatePose(const InterpolationInfo& framePair)
+void SkeletalModelNode::updatePose(const InterpolationInfo& framePair) const
 {
   BOOST_ASSERT(!m_model->bones.empty());
 
   BOOST_ASSERT(framePair.firstFrame->numValues > 0);
   BOOST_ASSERT(framePair.secondFrame->numValues > 0);
 
+  const PoseCache::Key poseKey{framePair.firstFrame.get(), framePair.secondFrame.get(), framePair.bias};
+  if(m_poseKey == poseKey)
+    return;
+
+  if(!m_hasPatches)
+  {
+    if(const auto pose = m_model->poseCache->find(poseKey))
+    {
+      BOOST_ASSERT(pose->size() <= m_meshParts.size());
+      for(size_t i = 0; i < pose->size(); ++i)
+        m_meshParts[i].poseMatrix = (*pose)[i];
+      m_poseKey = poseKey;
+      m_meshMatricesDirty = true;
+      return;
+    }
+  }
+
+  calculatePose(framePair);
+  m_poseKey = poseKey;
+  m_meshMatricesDirty = true;
+
+  if(!m_hasPatches)
+  {
+    auto pose = std::make_shared<PoseCache::Pose>();
+    pose->reserve(m_model->bones.size());
+    for(size_t i = 0; i < m_model->bones.size(); ++i)
+      pose->emplace_back(m_meshParts[i].poseMatrix);
+    m_model->poseCache->insert(poseKey, pose);
+  }
+}
+
+void SkeletalModelNode::calculatePose(const InterpolationInfo& framePair) const
+{
   const auto angleDataFirst = framePair.firstFrame->getAngleData();
   std::stack<glm::mat4> transformsFirst;
   transformsFirst.push(glm::translate(glm::mat4{1.0f}, framePair.firstFrame->pos.toGl())
@@ -147,6 +203,17 @@ void SkeletalModelNode::updatePose(const InterpolationInfo& framePair)
   }
 }
 
+void SkeletalModelNode::updateHasPatches()
+{
+  m_hasPatches = std::any_of(m_meshParts.begin(),
+                             m_meshParts.end(),
+                             [](const MeshPart& part)
+                             {
+                               return part.patch != glm::mat4{1.0f};
+                             });
+  m_poseKey.reset();
+}
+
 core::BoundingBox SkeletalModelNode::getBoundingBox() const
 {
   const auto framePair = getInterpolationInfo();
@@ -213,6 +280,7 @@ bool SkeletalModelNode::advanceFrame(objects::ObjectState& state)
 std::vector<SkeletalModelNode::Sphere> SkeletalModelNode::getBoneCollisionSpheres()
 {
   updatePose();
+  ensurePose();
   Expects(m_meshParts.size() == m_model->bones.size());
   std::vector<Sphere> result;
   result.reserve(m_meshParts.size());
@@ -226,6 +294,9 @@ std::vector<SkeletalModelNode::Sphere> SkeletalModelNode::getBoneCollisionSphere
 
 void SkeletalModelNode::serialize(const serialization::Serializer<world::World>& ser)
 {
+  if(!ser.loading)
+    ensurePose();
+
   auto id = getName();
   ser(S_NV("id", id),
       S_NV("model", m_model),
@@ -238,6 +309,7 @@ void SkeletalModelNode::serialize(const serialization::Serializer<world::World>&
     ser.lazy(
       [this](const serialization::Serializer<world::World>&)
       {
+        updateHasPatches();
         m_forceMeshRebuild = true;
         rebuildMesh();
         updatePose();
@@ -295,23 +367,43 @@ void SkeletalModelNode::rebuildMesh()
 
   m_forceMeshRebuild = false;
 
-  world::RenderMeshDataCompositor compositor;
+  // hidden parts are still composed, as visibility is applied through the bone palette
+  SkinnedMeshCache::Key key{{}, m_shadowCaster};
+  auto& partKeys = std::get<0>(key);
+  partKeys.reserve(m_meshParts.size());
   for(auto& part : m_meshParts)
   {
-    if(part.mesh == nullptr || !part.visible)
-      compositor.appendEmpty();
-    else
-      compositor.append(*part.mesh, part.reflective);
+    partKeys.emplace_back(part.mesh.get(), packReflective(part.reflective));
 
-    part.currentVisible = part.visible;
     part.currentMesh = part.mesh;
     part.currentReflective = part.reflective;
   }
 
+  if(const auto mesh = m_model->skinnedMeshCache->find(key))
+  {
+    setRenderable(mesh);
+    return;
+  }
+
+  world::RenderMeshDataCompositor compositor;
+  for(const auto& part : m_meshParts)
+  {
+    if(part.mesh == nullptr)
+      compositor.appendEmpty();
+    else
+      compositor.append(*part.mesh, part.reflective);
+  }
+
   if(compositor.empty())
+  {
     setRenderable(nullptr);
-  else
-    setRenderable(compositor.toMesh(*m_world->getPresenter().getMaterialManager(), true, m_shadowCaster, getName()));
+    return;
+  }
+
+  std::shared_ptr<render::scene::Mesh> mesh
+    = compositor.toMesh(*m_world->getPresenter().getMaterialManager(), true, m_shadowCaster, getName()).get();
+  m_model->skinnedMeshCache->insert(key, mesh);
+  setRenderable(mesh);
 }
 
 bool SkeletalModelNode::canBeCulled(const glm::mat4& viewProjection) const
@@ -336,6 +428,31 @@ bool SkeletalModelNode::canBeCulled(const glm::mat4& viewProjection) const
   return min.x > 1 || min.y > 1 || max.x < -1 || max.y < -1;
 }
 
+std::optional<std::tuple<glm::vec3, glm::vec3>> SkeletalModelNode::getLocalBounds() const
+{
+  if(m_anim == nullptr)
+    return std::nullopt;
+
+  // broadened, as the interpolated pose may leave the box of the keyframe
+  const auto bbox = getInterpolationInfo().firstFrame->bbox.toBBox();
+  const auto bx = bbox.x.broadened(bbox.x.size() / 2);
+  const auto by = bbox.y.broadened(bbox.y.size() / 2);
+  const auto bz = bbox.z.broadened(bbox.z.size() / 2);
+
+  glm::vec3 min{std::numeric_limits<float>::max()};
+  glm::vec3 max{std::numeric_limits<float>::lowest()};
+  for(const auto& x : {bx.min, bx.max})
+    for(const auto& y : {by.min, by.max})
+      for(const auto& z : {bz.min, bz.max})
+      {
+        const auto v = core::TRVec{x, y, z}.toRenderSystem();
+        min = glm::min(min, v);
+        max = glm::max(max, v);
+      }
+
+  return std::tuple{min, max};
+}
+
 void SkeletalModelNode::setAnim(const gsl::not_null<const world::Animation*>& anim,
                                 const std::optional<core::Frame>& frame)
 {
@@ -3,6 +3,7 @@
 #include "core/id.h"
 #include "core/units.h"
 #include "core/vec.h"
+#include "posecache.h"
 #include "render/scene/node.h"
 #include "serialization/serialization_fwd.h"
 
@@ -12,12 +13,14 @@
 #include <gl/pixel.h>
 #include <glm/fwd.hpp>
 #include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
 #include <gsl/gsl-lite.hpp>
 #include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -73,6 +76,7 @@ public:
                              gsl::not_null<const world::SkeletalModelType*> model,
                              bool shadowCaster);
 
+  //! @brief Requests the pose of the current frame; it is only calculated once the pose matrices are actually read
   void updatePose();
 
   void setAnimation(core::AnimStateId& animState,
@@ -86,7 +90,9 @@ public:
 
   void patchBone(const size_t idx, const glm::mat4& m)
   {
+    ensurePose();
     m_meshParts.at(idx).patch = m;
+    updateHasPatches();
   }
 
   [[nodiscard]] bool advanceFrame(objects::ObjectState& state);
@@ -135,6 +141,8 @@ public:
 
   [[nodiscard]] bool canBeCulled(const glm::mat4& viewProjection) const override;
 
+  [[nodiscard]] std::optional<std::tuple<glm::vec3, glm::vec3>> getLocalBounds() const override;
+
   void setMeshPart(size_t idx, const std::shared_ptr<world::RenderMeshData>& mesh)
   {
     m_meshParts.at(idx).mesh = mesh;
@@ -152,11 +160,13 @@ public:
 
   [[nodiscard]] const auto& getPoseMatrix(size_t idx) const
   {
+    ensurePose();
     return m_meshParts.at(idx).poseMatrix;
   }
 
   [[nodiscard]] glm::vec3 getMeshPartTranslationWorld(size_t idx) const
   {
+    ensurePose();
     auto m = getModelMatrix() * m_meshParts.at(idx).poseMatrix;
     return glm::vec3{m[3]};
   }
@@ -168,7 +178,10 @@ public:
 
   void setMeshMatrix(size_t idx, const glm::mat4& m)
   {
+    ensurePose();
     m_meshParts.at(idx).poseMatrix = m;
+    m_poseKey.reset();
+    m_meshMatricesDirty = true;
   }
 
   void setMeshReflective(size_t idx, const gl::SRGBA8& reflective)
@@ -176,9 +189,15 @@ public:
     m_meshParts.at(idx).reflective = reflective;
   }
 
+  //! @brief Hides or shows a bone mesh; this only changes the uploaded bone palette, the geometry is not rebuilt
   void setVisible(size_t idx, bool visible)
   {
-    m_meshParts.at(idx).visible = visible;
+    auto& part = m_meshParts.at(idx);
+    if(part.visible == visible)
+      return;
+
+    part.visible = visible;
+    m_meshMatricesDirty = true;
   }
 
   bool isVisible(size_t idx) const
@@ -188,21 +207,36 @@ public:
 
   [[nodiscard]] const auto& getMeshMatricesBuffer() const
   {
+    ensurePose();
+    if(!m_meshMatricesDirty)
+      return m_meshMatricesBuffer;
+
     std::vector<glm::mat4> matrices;
     std::transform(m_meshParts.begin(),
                    m_meshParts.end(),
                    std::back_inserter(matrices),
                    [](const auto& part)
                    {
-                     return part.poseMatrix;
+                     if(part.visible)
+                       return part.poseMatrix;
+
+                     // the shaders move the vertices of a bone outside of the clip volume if w is zero
+                     auto hidden = glm::mat4{1.0f};
+                     hidden[3][3] = 0.0f;
+                     return hidden;
                    });
     m_meshMatricesBuffer.setData(matrices, gl::api::BufferUsage::DynamicDraw);
+    m_meshMatricesDirty = false;
     return m_meshMatricesBuffer;
   }
 
   void clearParts()
   {
     m_meshParts.clear();
+    m_hasPatches = false;
+    m_poseKey.reset();
+    m_pendingPoseKey.reset();
+    m_meshMatricesDirty = true;
     m_forceMeshRebuild = true;
     rebuildMesh();
   }
@@ -236,17 +270,17 @@ private:
     }
 
     glm::mat4 patch{1.0f};
-    glm::mat4 poseMatrix{1.0f};
+    //! @brief Mutable because pending poses are materialized lazily from const accessors
+    mutable glm::mat4 poseMatrix{1.0f};
     std::shared_ptr<world::RenderMeshData> mesh{nullptr};
     std::shared_ptr<world::RenderMeshData> currentMesh{nullptr};
     bool visible = true;
-    bool currentVisible = true;
     gl::SRGBA8 reflective{0, 0, 0, 0};
     gl::SRGBA8 currentReflective{0, 0, 0, 0};
 
     [[nodiscard]] bool meshChanged() const
     {
-      return visible != currentVisible || mesh != currentMesh || reflective != currentReflective;
+      return mesh != currentMesh || reflective != currentReflective;
     }
 
     void serialize(const serialization::Serializer<world::World>& ser);
@@ -262,7 +296,20 @@ private:
   const world::Animation* m_anim = nullptr;
   core::Frame m_frame = 0_frame;
 
-  void updatePose(const InterpolationInfo& framePair);
+  //! @brief The keyframes the current pose matrices were calculated from, if they are still up to date
+  mutable std::optional<PoseCache::Key> m_poseKey;
+  //! @brief The keyframes requested by the last updatePose() call that have not been evaluated yet
+  mutable std::optional<PoseCache::Key> m_pendingPoseKey;
+  //! @brief Whether the pose matrices changed since they were last uploaded to the mesh matrices buffer
+  mutable bool m_meshMatricesDirty = true;
+  //! @brief Whether any bone is patched, which prevents using the model's shared pose cache
+  bool m_hasPatches = false;
+
+  //! @brief Evaluates a pending pose request, so that nodes which are never drawn or queried never pay for it
+  void ensurePose() const;
+  void updatePose(const InterpolationInfo& framePair) const;
+  void calculatePose(const InterpolationInfo& framePair) const;
+  void updateHasPatches();
 
   bool m_shadowCaster;
 };
@@ -0,0 +1,22 @@
+#include "skinnedmeshcache.h"
+
+#include "render/scene/mesh.h" // IWYU pragma: keep
+
+namespace engine
+{
+std::shared_ptr<render::scene::Mesh> SkinnedMeshCache::find(const Key& key) const
+{
+  const auto it = m_meshes.find(key);
+  return it == m_meshes.end() ? nullptr : it->second;
+}
+
+void SkinnedMeshCache::insert(const Key& key, const std::shared_ptr<render::scene::Mesh>& mesh)
+{
+  if(m_meshes.size() >= MaxEntries)
+  {
+    // meshes still in use are kept alive by their nodes, so flushing only affects future swaps
+    m_meshes.clear();
+  }
+  m_meshes.emplace(key, mesh);
+}
+} // namespace engine
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace render::scene
+{
+class Mesh;
+}
+
+namespace engine::world
+{
+class RenderMeshData;
+}
+
+namespace engine
+{
+//! @brief Skinned meshes composed from the bone meshes of a skeletal model, shared by all instances of the model.
+//! @details Swapping bone meshes back and forth only needs to compose each combination once, and instances using
+//!          the same combination render the same geometry.
+class SkinnedMeshCache final
+{
+public:
+  //! @brief Mesh and packed reflective colour per bone, and whether the mesh casts shadows
+  using Key = std::tuple<std::vector<std::tuple<const world::RenderMeshData*, uint32_t>>, bool>;
+
+  [[nodiscard]] std::shared_ptr<render::scene::Mesh> find(const Key& key) const;
+  void insert(const Key& key, const std::shared_ptr<render::scene::Mesh>& mesh);
+
+private:
+  static constexpr size_t MaxEntries = 32;
+
+  std::map<Key, std::shared_ptr<render::scene::Mesh>> m_meshes;
+};
+} // namespace engine
@@ -0,0 +1,495 @@
+#include "spriteparticles.h"
+
+#include "core/magic.h"
+#include "core/vec.h"
+#include "heightinfo.h"
+#include "items_tr1.h"
+#include "lighting.h"
+#include "objectmanager.h"
+#include "objects/laraobject.h"
+#include "objects/objectstate.h"
+#include "presenter.h"
+#include "render/scene/materialmanager.h"
+#include "render/scene/mesh.h"
+#include "render/scene/node.h"
+#include "render/scene/sprite.h"
+#include "util/helpers.h"
+#include "world/room.h"
+#include "world/sprite.h"
+#include "world/world.h"
+
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <boost/log/trivial.hpp>
+#include <gl/program.h>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
+#include <gsl/gsl-lite.hpp>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+
+namespace engine
+{
+namespace
+{
+//! @brief The lighting the sprite shader applies to a fragment, evaluated once per particle.
+float getBrightness(const world::Room& room, const glm::vec3& position)
+{
+  auto brightness = toBrightness(room.ambientShade).get();
+  for(const auto& light : room.bufferLights)
+  {
+    if(light.fadeDistance <= 0)
+      continue;
+
+    const auto r = glm::distance(glm::vec3{light.position}, position) / light.fadeDistance;
+    brightness += light.brightness / (r * r + 1);
+  }
+  return brightness;
+}
+} // namespace
+
+SpriteParticlePool::SpriteParticlePool(
+  const std::string& name, const core::TypeId& type, bool billboard, size_t capacity, world::World& world)
+    : m_capacity{capacity}
+    , m_soundEngine{gsl::not_null{world.getPresenter().getSoundEngine().get()}}
+    , m_node{gsl::make_shared<render::scene::Node>(name)}
+    , m_instanceBuffer{gsl::make_shared<gl::ShaderStorageBuffer<render::scene::SpriteInstance>>(name + "-instances")}
+{
+  m_locations.reserve(capacity);
+  m_angles.reserve(capacity);
+  m_speeds.reserve(capacity);
+  m_fallSpeeds.reserve(capacity);
+  m_negSpriteFrameIds.reserve(capacity);
+  m_timers.reserve(capacity);
+  m_drawnFrames.reserve(capacity);
+  m_emitters.reserve(capacity);
+  m_expired.reserve(capacity);
+  m_instances.reserve(capacity);
+  m_node->setVisible(false);
+
+  const auto& spriteSequence = world.findSpriteSequenceForType(type);
+  if(spriteSequence == nullptr || spriteSequence->sprites.empty())
+  {
+    BOOST_LOG_TRIVIAL(warning) << "Missing sprite referenced by particle: "
+                               << toString(static_cast<TR1ItemId>(type.get()));
+    return;
+  }
+
+  for(const world::Sprite& sprite : spriteSequence->sprites)
+  {
+    m_frames.emplace_back(sprite.toSpriteFrame());
+    // particles are rotated, so the bounds must cover the farthest sprite corner in every direction
+    for(const auto x : {sprite.render0.x, sprite.render1.x})
+      for(const auto y : {sprite.render0.y, sprite.render1.y})
+        m_radius = std::max(m_radius, glm::length(glm::vec2{x, y}));
+  }
+
+  m_mesh = render::scene::createInstancedSpriteMesh(
+    world.getPresenter().getMaterialManager()->getSprite(billboard, true), name);
+  m_node->setRenderable(m_mesh);
+  // the particles are spread over multiple rooms, so they can't be clipped to the portals of a single room
+  m_node->getRenderState().setScissorTest(false);
+  m_node->bind("u_lightAmbient",
+               [](const render::scene::Node* /*node*/, const render::scene::Mesh& /*mesh*/, gl::Uniform& uniform)
+               {
+                 uniform.set(1.0f);
+               });
+  m_node->bind("b_lights",
+               [emptyLightsBuffer = ShaderLight::getEmptyBuffer()](const render::scene::Node*,
+                                                                   const render::scene::Mesh& /*mesh*/,
+                                                                   gl::ShaderStorageBlock& shaderStorageBlock)
+               {
+                 shaderStorageBlock.bind(*emptyLightsBuffer);
+               });
+  m_node->bind("b_instances",
+               [instanceBuffer = m_instanceBuffer](const render::scene::Node*,
+                                                   const render::scene::Mesh& /*mesh*/,
+                                                   gl::ShaderStorageBlock& shaderStorageBlock)
+               {
+                 shaderStorageBlock.bind(*instanceBuffer);
+               });
+}
+
+SpriteParticlePool::~SpriteParticlePool() = default;
+
+std::optional<size_t> SpriteParticlePool::emplace(const Location& location)
+{
+  if(m_frames.empty() || m_locations.size() >= m_capacity)
+    return std::nullopt;
+
+  m_locations.emplace_back(location);
+  m_angles.emplace_back();
+  m_speeds.emplace_back(0_spd);
+  m_fallSpeeds.emplace_back(0_spd);
+  m_negSpriteFrameIds.emplace_back(int16_t{0});
+  m_timers.emplace_back(int16_t{0});
+  m_drawnFrames.emplace_back(0);
+  m_emitters.emplace_back(nullptr);
+  return m_locations.size() - 1;
+}
+
+void SpriteParticlePool::eraseExpired()
+{
+  eraseExpired(m_locations);
+  eraseExpired(m_angles);
+  eraseExpired(m_speeds);
+  eraseExpired(m_fallSpeeds);
+  eraseExpired(m_negSpriteFrameIds);
+  eraseExpired(m_timers);
+  eraseExpired(m_drawnFrames);
+  eraseExpired(m_emitters);
+}
+
+void SpriteParticlePool::nextFrame(const size_t i)
+{
+  --m_negSpriteFrameIds[i];
+  m_drawnFrames[i] = (m_drawnFrames[i] + 1) % m_frames.size();
+}
+
+gsl::not_null<audio::Emitter*> SpriteParticlePool::getEmitter(const size_t i)
+{
+  BOOST_ASSERT(i < m_emitters.size());
+
+  if(m_emitters[i] == nullptr)
+    m_emitters[i] = std::make_unique<ParticleEmitter>(m_locations[i].position.toRenderSystem(), m_soundEngine);
+  return gsl::not_null{m_emitters[i].get()};
+}
+
+void SpriteParticlePool::update(world::World& world)
+{
+  m_expired.assign(m_locations.size(), false);
+  for(size_t i = 0; i < m_expired.size(); ++i)
+    m_expired[i] = !updateParticle(world, i);
+
+  eraseExpired();
+}
+
+void SpriteParticlePool::updateInstances()
+{
+  if(m_mesh == nullptr)
+    return;
+
+  m_node->setVisible(!m_locations.empty());
+  if(m_locations.empty())
+    return;
+
+  m_instances.clear();
+  glm::vec3 boundsMin{std::numeric_limits<float>::max()};
+  glm::vec3 boundsMax{std::numeric_limits<float>::lowest()};
+  for(size_t i = 0; i < m_locations.size(); ++i)
+  {
+    const auto position = m_locations[i].position.toRenderSystem();
+    if(m_emitters[i] != nullptr)
+      m_emitters[i]->position = position;
+
+    m_instances.emplace_back(m_frames[m_drawnFrames[i]],
+                             translate(glm::mat4{1.0f}, position) * m_angles[i].toMatrix(),
+                             getBrightness(*m_locations[i].room, position));
+    boundsMin = glm::min(boundsMin, position - glm::vec3{m_radius});
+    boundsMax = glm::max(boundsMax, position + glm::vec3{m_radius});
+  }
+
+  m_instanceBuffer->setData(m_instances, gl::api::BufferUsage::StreamDraw);
+  m_mesh->setInstanceCount(gsl::narrow<gl::api::core::SizeType>(m_instances.size()));
+  m_node->setLocalBounds(boundsMin, boundsMax);
+}
+
+BloodSplatterParticles::BloodSplatterParticles(world::World& world)
+    : SpriteParticlePool{"bloodsplat", TR1ItemId::Blood, true, 256, world}
+{
+}
+
+std::optional<size_t>
+  BloodSplatterParticles::emit(const Location& location, const core::Speed& speed, const core::Angle& angle)
+{
+  const auto i = emplace(location);
+  if(i.has_value())
+  {
+    m_speeds[*i] = speed;
+    m_angles[*i].Y = angle;
+  }
+  return i;
+}
+
+bool BloodSplatterParticles::updateParticle(world::World& /*world*/, const size_t i)
+{
+  m_locations[i].position += util::pitch(m_speeds[i] * 1_frame, m_angles[i].Y);
+  m_locations[i].updateRoom();
+  ++m_timers[i];
+  if(m_timers[i] != 4)
+    return true;
+
+  m_timers[i] = 0;
+  nextFrame(i);
+  return gsl::narrow<size_t>(-m_negSpriteFrameIds[i]) < getFrameCount();
+}
+
+SplashParticles::SplashParticles(world::World& world)
+    : SpriteParticlePool{"splash", TR1ItemId::Splash, false, 256, world}
+{
+}
+
+std::optional<size_t> SplashParticles::emit(const Location& location, const bool waterfall)
+{
+  const auto i = emplace(location);
+  if(!i.has_value())
+    return i;
+
+  if(!waterfall)
+  {
+    m_speeds[*i] = util::rand15(128_spd);
+    m_angles[*i].Y = core::auToAngle(2 * util::rand15s());
+  }
+  else
+  {
+    m_locations[*i].position.X += util::rand15s(1_sectors);
+    m_locations[*i].position.Z += util::rand15s(1_sectors);
+  }
+  return i;
+}
+
+bool SplashParticles::updateParticle(world::World& /*world*/, const size_t i)
+{
+  nextFrame(i);
+  if(gsl::narrow<size_t>(-m_negSpriteFrameIds[i]) >= getFrameCount())
+    return false;
+
+  m_locations[i].position += util::pitch(m_speeds[i] * 1_frame, m_angles[i].Y);
+  m_locations[i].updateRoom();
+  return true;
+}
+
+RicochetParticles::RicochetParticles(world::World& world)
+    : SpriteParticlePool{"ricochet", TR1ItemId::Ricochet, false, 64, world}
+{
+}
+
+std::optional<size_t>
+  RicochetParticles::emit(const Location& location, const int16_t duration, const core::TRRotation& angle)
+{
+  const auto i = emplace(location);
+  if(!i.has_value())
+    return i;
+
+  m_timers[*i] = duration;
+  m_angles[*i] = angle;
+  const int n = util::rand15(3);
+  for(int j = 0; j < n; ++j)
+    nextFrame(*i);
+  return i;
+}
+
+bool RicochetParticles::updateParticle(world::World& /*world*/, const size_t i)
+{
+  --m_timers[i];
+  return m_timers[i] != 0;
+}
+
+BubbleParticles::BubbleParticles(world::World& world)
+    : SpriteParticlePool{"bubble", TR1ItemId::Bubbles, true, 256, world}
+{
+  m_onlyInWater.reserve(256);
+}
+
+std::optional<size_t> BubbleParticles::emit(const Location& location, const bool onlyInWater)
+{
+  const auto i = emplace(location);
+  if(!i.has_value())
+    return i;
+
+  m_onlyInWater.emplace_back(onlyInWater);
+  m_speeds[*i] = 10_spd + util::rand15(6_spd);
+  const int n = util::rand15(3);
+  for(int j = 0; j < n; ++j)
+    nextFrame(*i);
+  return i;
+}
+
+void BubbleParticles::eraseExpired()
+{
+  SpriteParticlePool::eraseExpired(m_onlyInWater);
+  SpriteParticlePool::eraseExpired();
+}
+
+bool BubbleParticles::updateParticle(world::World& world, const size_t i)
+{
+  auto& location = m_locations[i];
+  m_angles[i].X += 13_deg;
+  m_angles[i].Y += 9_deg;
+  location.position += util::pitch(11_len, m_angles[i].Y, -m_speeds[i] * 1_frame);
+  const auto sector = location.updateRoom();
+  if(m_onlyInWater[i] && !location.room->isWaterRoom)
+    return false;
+
+  const auto ceiling = HeightInfo::fromCeiling(sector, location.position, world.getObjectManager().getObjects()).y;
+  return ceiling != core::InvalidHeight && location.position.Y > ceiling;
+}
+
+SparkleParticles::SparkleParticles(world::World& world)
+    : SpriteParticlePool{"sparkles", TR1ItemId::Sparkles, true, 256, world}
+{
+}
+
+std::optional<size_t> SparkleParticles::emit(const Location& location)
+{
+  return emplace(location);
+}
+
+bool SparkleParticles::updateParticle(world::World& /*world*/, const size_t i)
+{
+  ++m_timers[i];
+  if(m_timers[i] != 1)
+    return true;
+
+  // sparkles expire after showing their first frame for as many frames as the sequence has
+  --m_negSpriteFrameIds[i];
+  m_timers[i] = 0;
+  return gsl::narrow<size_t>(-m_negSpriteFrameIds[i]) < getFrameCount();
+}
+
+ExplosionParticles::ExplosionParticles(world::World& world)
+    : SpriteParticlePool{"explosion", TR1ItemId::Explosion, true, 64, world}
+{
+}
+
+std::optional<size_t> ExplosionParticles::emit(const Location& location, const core::TRRotation& angle)
+{
+  const auto i = emplace(location);
+  if(i.has_value())
+    m_angles[*i] = angle;
+  return i;
+}
+
+bool ExplosionParticles::updateParticle(world::World& /*world*/, const size_t i)
+{
+  ++m_timers[i];
+  if(m_timers[i] != 2)
+    return true;
+
+  m_timers[i] = 0;
+  nextFrame(i);
+  return gsl::narrow<size_t>(-m_negSpriteFrameIds[i]) < getFrameCount();
+}
+
+LavaParticles::LavaParticles(world::World& world)
+    : SpriteParticlePool{"lava", TR1ItemId::LavaParticles, true, 256, world}
+{
+}
+
+std::optional<size_t> LavaParticles::emit(const Location& location)
+{
+  const auto i = emplace(location);
+  if(!i.has_value())
+    return i;
+
+  // the frame counter is randomized, but lava particles always show the first frame of their sequence
+  m_angles[*i].Y = util::rand15(180_deg) * 2;
+  m_speeds[*i] = util::rand15(32_spd);
+  m_fallSpeeds[*i] = -util::rand15(165_spd);
+  m_negSpriteFrameIds[*i] = util::rand15(int16_t{-4});
+  return i;
+}
+
+bool LavaParticles::updateParticle(world::World& world, const size_t i)
+{
+  auto& location = m_locations[i];
+  m_fallSpeeds[i] += core::Gravity * 1_frame;
+  location.position += util::pitch(m_speeds[i] * 1_frame, m_angles[i].Y, m_fallSpeeds[i] * 1_frame);
+
+  const auto sector = location.updateRoom();
+  if(HeightInfo::fromFloor(sector, location.position, world.getObjectManager().getObjects()).y <= location.position.Y
+     || HeightInfo::fromCeiling(sector, location.position, world.getObjectManager().getObjects()).y
+          > location.position.Y)
+  {
+    return false;
+  }
+
+  if(auto& lara = world.getObjectManager().getLara(); lara.isNearInexact(location.position, 200_len))
+  {
+    lara.m_state.health -= 10_hp;
+    lara.m_state.is_hit = true;
+    return false;
+  }
+
+  return true;
+}
+
+SmokeParticles::SmokeParticles(world::World& world)
+    : SpriteParticlePool{"smoke", TR1ItemId::Smoke, false, 64, world}
+{
+}
+
+std::optional<size_t> SmokeParticles::emit(const Location& location, const core::TRRotation& angle)
+{
+  const auto i = emplace(location);
+  if(i.has_value())
+    m_angles[*i] = angle;
+  return i;
+}
+
+bool SmokeParticles::updateParticle(world::World& /*world*/, const size_t i)
+{
+  ++m_timers[i];
+  if(m_timers[i] < 3)
+    return true;
+
+  m_timers[i] = 0;
+  nextFrame(i);
+  return gsl::narrow<size_t>(-m_negSpriteFrameIds[i]) < getFrameCount();
+}
+
+SpriteParticles::SpriteParticles(world::World& world)
+    : bloodSplatter{world}
+    , splash{world}
+    , ricochet{world}
+    , bubble{world}
+    , sparkle{world}
+    , explosion{world}
+    , lava{world}
+    , smoke{world}
+{
+}
+
+void SpriteParticles::update(world::World& world)
+{
+  bloodSplatter.update(world);
+  splash.update(world);
+  ricochet.update(world);
+  bubble.update(world);
+  sparkle.update(world);
+  explosion.update(world);
+  lava.update(world);
+  smoke.update(world);
+}
+
+void SpriteParticles::updateInstances()
+{
+  bloodSplatter.updateInstances();
+  splash.updateInstances();
+  ricochet.updateInstances();
+  bubble.updateInstances();
+  sparkle.updateInstances();
+  explosion.updateInstances();
+  lava.updateInstances();
+  smoke.updateInstances();
+}
+
+void SpriteParticles::attachTo(const std::shared_ptr<render::scene::Node>& parent) const
+{
+  for(const SpriteParticlePool* pool : {static_cast<const SpriteParticlePool*>(&bloodSplatter),
+                                        static_cast<const SpriteParticlePool*>(&splash),
+                                        static_cast<const SpriteParticlePool*>(&ricochet),
+                                        static_cast<const SpriteParticlePool*>(&bubble),
+                                        static_cast<const SpriteParticlePool*>(&sparkle),
+                                        static_cast<const SpriteParticlePool*>(&explosion),
+                                        static_cast<const SpriteParticlePool*>(&lava),
+                                        static_cast<const SpriteParticlePool*>(&smoke)})
+  {
+    setParent(pool->getNode(), parent);
+  }
+}
+} // namespace engine
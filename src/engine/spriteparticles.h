@@ -0,0 +1,264 @@
+#pragma once
+
+#include "audio/emitter.h"
+#include "core/angle.h"
+#include "core/id.h"
+#include "core/units.h"
+#include "location.h"
+#include "render/scene/sprite.h"
+
+#include <boost/assert.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <gl/buffer.h>
+#include <glm/vec3.hpp>
+#include <gsl/gsl-lite.hpp>
+#include <gslu.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace audio
+{
+class SoundEngine;
+}
+
+namespace render::scene
+{
+class Mesh;
+class Node;
+} // namespace render::scene
+
+namespace engine::world
+{
+class World;
+}
+
+namespace engine
+{
+//! @brief Fixed-capacity structure-of-arrays storage of particles showing the frames of a sprite sequence.
+//! @details All particles of a pool are drawn with a single instanced draw of a unit quad. Each instance carries the
+//!          particle's transform, brightness and sprite frame. Particles are kept and updated in emission order.
+class SpriteParticlePool
+{
+public:
+  explicit SpriteParticlePool(
+    const std::string& name, const core::TypeId& type, bool billboard, size_t capacity, world::World& world);
+  virtual ~SpriteParticlePool();
+
+  SpriteParticlePool(const SpriteParticlePool&) = delete;
+  SpriteParticlePool(SpriteParticlePool&&) = delete;
+  SpriteParticlePool& operator=(SpriteParticlePool&&) = delete;
+  SpriteParticlePool& operator=(const SpriteParticlePool&) = delete;
+
+  //! @brief Advances all particles by one frame and drops the expired ones.
+  //! @details Particles emitted while updating are first updated in the next frame.
+  void update(world::World& world);
+
+  //! @brief Uploads the instance data of all particles for rendering.
+  void updateInstances();
+
+  //! @brief Returns the audio emitter following particle @p i, which is valid until the particle expires.
+  [[nodiscard]] gsl::not_null<audio::Emitter*> getEmitter(size_t i);
+
+  [[nodiscard]] size_t size() const noexcept
+  {
+    return m_locations.size();
+  }
+
+  [[nodiscard]] const auto& getNode() const noexcept
+  {
+    return m_node;
+  }
+
+protected:
+  std::vector<Location> m_locations;
+  std::vector<core::TRRotation> m_angles;
+  std::vector<core::Speed> m_speeds;
+  std::vector<core::Speed> m_fallSpeeds;
+  std::vector<int16_t> m_negSpriteFrameIds;
+  std::vector<int16_t> m_timers;
+
+  //! @brief Adds a particle with all other columns zeroed.
+  //! @returns The index of the new particle, or std::nullopt if the pool is full or has no sprites.
+  std::optional<size_t> emplace(const Location& location);
+
+  //! @brief Drops the particles flagged in m_expired; pools with additional columns must compact them, too.
+  virtual void eraseExpired();
+
+  template<typename T>
+  void eraseExpired(std::vector<T>& column) const
+  {
+    BOOST_ASSERT(column.size() == m_expired.size());
+
+    size_t kept = 0;
+    for(size_t i = 0; i < column.size(); ++i)
+    {
+      if(m_expired[i])
+        continue;
+
+      if(kept != i)
+        column[kept] = std::move(column[i]);
+      ++kept;
+    }
+    column.erase(column.begin() + gsl::narrow<std::ptrdiff_t>(kept), column.end());
+  }
+
+  //! @brief Decrements the frame counter of particle @p i and draws its next sprite frame.
+  void nextFrame(size_t i);
+
+  [[nodiscard]] size_t getFrameCount() const noexcept
+  {
+    return m_frames.size();
+  }
+
+private:
+  struct ParticleEmitter final : public audio::Emitter
+  {
+    glm::vec3 position;
+
+    ParticleEmitter(const glm::vec3& position, const gsl::not_null<audio::SoundEngine*>& engine)
+        : Emitter{engine}
+        , position{position}
+    {
+    }
+
+    glm::vec3 getPosition() const override
+    {
+      return position;
+    }
+  };
+
+  const size_t m_capacity;
+  gsl::not_null<audio::SoundEngine*> m_soundEngine;
+  std::vector<render::scene::SpriteFrame> m_frames;
+  //! @brief The drawn frame of each particle, which only some particle types advance along with their frame counter
+  std::vector<size_t> m_drawnFrames;
+  //! @brief The audio emitters of the particles playing a sound, created on demand
+  std::vector<std::unique_ptr<ParticleEmitter>> m_emitters;
+  std::vector<bool> m_expired;
+  //! @brief The maximum distance of a sprite vertex from the particle position, used for the instance bounds
+  float m_radius = 0;
+  gslu::nn_shared<render::scene::Node> m_node;
+  std::shared_ptr<render::scene::Mesh> m_mesh;
+  gslu::nn_shared<gl::ShaderStorageBuffer<render::scene::SpriteInstance>> m_instanceBuffer;
+  std::vector<render::scene::SpriteInstance> m_instances;
+
+  //! @brief Advances particle @p i by one frame.
+  //! @returns false if the particle expired.
+  virtual bool updateParticle(world::World& world, size_t i) = 0;
+};
+
+class BloodSplatterParticles final : public SpriteParticlePool
+{
+public:
+  explicit BloodSplatterParticles(world::World& world);
+
+  std::optional<size_t> emit(const Location& location, const core::Speed& speed, const core::Angle& angle);
+
+private:
+  bool updateParticle(world::World& world, size_t i) override;
+};
+
+class SplashParticles final : public SpriteParticlePool
+{
+public:
+  explicit SplashParticles(world::World& world);
+
+  std::optional<size_t> emit(const Location& location, bool waterfall);
+
+private:
+  bool updateParticle(world::World& world, size_t i) override;
+};
+
+class RicochetParticles final : public SpriteParticlePool
+{
+public:
+  explicit RicochetParticles(world::World& world);
+
+  std::optional<size_t>
+    emit(const Location& location, int16_t duration = 4, const core::TRRotation& angle = core::TRRotation{});
+
+private:
+  bool updateParticle(world::World& world, size_t i) override;
+};
+
+class BubbleParticles final : public SpriteParticlePool
+{
+public:
+  explicit BubbleParticles(world::World& world);
+
+  std::optional<size_t> emit(const Location& location, bool onlyInWater = true);
+
+private:
+  std::vector<bool> m_onlyInWater;
+
+  void eraseExpired() override;
+  bool updateParticle(world::World& world, size_t i) override;
+};
+
+class SparkleParticles final : public SpriteParticlePool
+{
+public:
+  explicit SparkleParticles(world::World& world);
+
+  std::optional<size_t> emit(const Location& location);
+
+private:
+  bool updateParticle(world::World& world, size_t i) override;
+};
+
+class ExplosionParticles final : public SpriteParticlePool
+{
+public:
+  explicit ExplosionParticles(world::World& world);
+
+  std::optional<size_t> emit(const Location& location, const core::TRRotation& angle = core::TRRotation{});
+
+private:
+  bool updateParticle(world::World& world, size_t i) override;
+};
+
+class LavaParticles final : public SpriteParticlePool
+{
+public:
+  explicit LavaParticles(world::World& world);
+
+  std::optional<size_t> emit(const Location& location);
+
+private:
+  bool updateParticle(world::World& world, size_t i) override;
+};
+
+class SmokeParticles final : public SpriteParticlePool
+{
+public:
+  explicit SmokeParticles(world::World& world);
+
+  std::optional<size_t> emit(const Location& location, const core::TRRotation& angle);
+
+private:
+  bool updateParticle(world::World& world, size_t i) override;
+};
+
+//! @brief The particles drawn from sprite sequences, pooled per particle type.
+struct SpriteParticles
+{
+  explicit SpriteParticles(world::World& world);
+
+  void update(world::World& world);
+  void updateInstances();
+  void attachTo(const std::shared_ptr<render::scene::Node>& parent) const;
+
+  BloodSplatterParticles bloodSplatter;
+  SplashParticles splash;
+  RicochetParticles ricochet;
+  BubbleParticles bubble;
+  SparkleParticles sparkle;
+  ExplosionParticles explosion;
+  LavaParticles lava;
+  SmokeParticles smoke;
+};
+} // namespace engine
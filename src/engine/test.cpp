@@ -0,0 +1,249 @@
+#define BOOST_TEST_MODULE engine
+
+#include "ai/pathfinder.h"
+#include "core/magic.h"
+#include "util/workerpool.h"
+#include "world/box.h"
+#include "world/boxregiongraph.h"
+
+#include <boost/test/unit_test.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+//! @brief A set of boxes owning the adjacency lists the boxes refer to
+struct BoxSet
+{
+  explicit BoxSet(const std::vector<core::Length>& floors)
+      : overlaps(floors.size())
+      , boxes(floors.size())
+  {
+    for(uint32_t i = 0; i < floors.size(); ++i)
+    {
+      boxes[i].index = i;
+      boxes[i].floor = floors[i];
+    }
+  }
+
+  void connect(const uint32_t from, const uint32_t to)
+  {
+    overlaps[from].emplace_back(engine::world::BoxOverlap{to, boxes[to].floor, boxes[to].zones});
+    boxes[from].overlaps = overlaps[from];
+  }
+
+  void connectBoth(const uint32_t a, const uint32_t b)
+  {
+    connect(a, b);
+    connect(b, a);
+  }
+
+  [[nodiscard]] engine::world::BoxRegionGraph buildGraph() const
+  {
+    return engine::world::BoxRegionGraph{
+      boxes, &engine::world::BoxZones::ground1, core::QuarterSectorSize, -core::SectorSize};
+  }
+
+  std::vector<std::vector<engine::world::BoxOverlap>> overlaps;
+  std::vector<engine::world::Box> boxes;
+};
+
+//! @brief Simulates objects with a split update, where serial updates affect the following objects
+struct UpdateReplay
+{
+  explicit UpdateReplay(const uint32_t seed)
+  {
+    std::mt19937 rng{seed};
+    for(size_t i = 0; i < ObjectCount; ++i)
+    {
+      isSplit.emplace_back(rng() % 4 != 0);
+      values.emplace_back(static_cast<int64_t>(rng() % 1000));
+    }
+  }
+
+  void updateParallel(const size_t i)
+  {
+    values[i] = values[i] * 3 + 1;
+  }
+
+  void commitUpdate(const size_t i)
+  {
+    world = world * 17 + values[i];
+    log.emplace_back(i);
+  }
+
+  void update(const size_t i)
+  {
+    world = world * 31 + values[i];
+    values[(i + 1) % ObjectCount] += world % 7;
+    log.emplace_back(i);
+  }
+
+  static constexpr size_t ObjectCount = 200;
+  std::vector<bool> isSplit;
+  std::vector<int64_t> values;
+  int64_t world = 0;
+  std::vector<size_t> log;
+};
+
+void replayUpdates(util::WorkerPool& pool, UpdateReplay& replay)
+{
+  pool.orderedSplitFor(
+    UpdateReplay::ObjectCount,
+    [&replay](const size_t i)
+    {
+      return replay.isSplit[i];
+    },
+    [&replay](const size_t i)
+    {
+      replay.updateParallel(i);
+    },
+    [&replay](const size_t i)
+    {
+      replay.commitUpdate(i);
+    },
+    [&replay](const size_t i)
+    {
+      replay.update(i);
+    });
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(engine_tests)
+
+BOOST_AUTO_TEST_CASE(test_box_regions_follow_movement_limits)
+{
+  BoxSet set{{0_len, 0_len, 1_sectors / 2, 0_len}};
+  set.connectBoth(0, 1);
+  // box 2 can only be left, as the step from box 1 is too high
+  set.connectBoth(1, 2);
+  // box 3 is in another zone
+  set.boxes[3].zones.ground1 = 1;
+  set.connectBoth(0, 3);
+
+  const auto graph = set.buildGraph();
+  const auto upper = graph.getRegion(set.boxes[0]);
+  const auto lower = graph.getRegion(set.boxes[2]);
+  const auto other = graph.getRegion(set.boxes[3]);
+  BOOST_CHECK_EQUAL(graph.getRegionCount(), size_t{3});
+  BOOST_CHECK_EQUAL(graph.getRegion(set.boxes[1]), upper);
+  BOOST_CHECK_NE(upper, lower);
+  BOOST_CHECK_NE(upper, other);
+  BOOST_CHECK_NE(lower, other);
+
+  BOOST_CHECK(graph.canReach(upper, upper));
+  BOOST_CHECK(graph.canReach(lower, upper));
+  BOOST_CHECK(!graph.canReach(upper, lower));
+  BOOST_CHECK(!graph.canReach(upper, other));
+  BOOST_CHECK(!graph.canReach(other, upper));
+}
+
+BOOST_AUTO_TEST_CASE(test_box_regions_between)
+{
+  // a one-way chain 0 -> 1 -> 2 with a dead end 1 -> 3
+  BoxSet set{{1_sectors, 1_sectors / 2, 0_len, 0_len}};
+  set.connectBoth(0, 1);
+  set.connectBoth(1, 2);
+  set.connectBoth(1, 3);
+
+  const auto graph = set.buildGraph();
+  BOOST_CHECK_EQUAL(graph.getRegionCount(), size_t{4});
+  const auto start = graph.getRegion(set.boxes[0]);
+  const auto middle = graph.getRegion(set.boxes[1]);
+  const auto target = graph.getRegion(set.boxes[2]);
+  const auto deadEnd = graph.getRegion(set.boxes[3]);
+
+  BOOST_CHECK(graph.isBetween(start, start, target));
+  BOOST_CHECK(graph.isBetween(middle, start, target));
+  BOOST_CHECK(graph.isBetween(target, start, target));
+  BOOST_CHECK(!graph.isBetween(deadEnd, start, target));
+  BOOST_CHECK(!graph.isBetween(middle, target, start));
+}
+
+BOOST_AUTO_TEST_CASE(test_box_regions_long_cycle)
+{
+  // deep enough to overflow the stack of a recursive implementation
+  static constexpr uint32_t BoxCount = 100000;
+  BoxSet set{std::vector<core::Length>(BoxCount, 0_len)};
+  for(uint32_t i = 0; i < BoxCount; ++i)
+    set.connect(i, (i + 1) % BoxCount);
+
+  const auto graph = set.buildGraph();
+  BOOST_CHECK_EQUAL(graph.getRegionCount(), size_t{1});
+  BOOST_CHECK_EQUAL(graph.getRegion(set.boxes.front()), graph.getRegion(set.boxes.back()));
+}
+
+BOOST_AUTO_TEST_CASE(test_path_finder_search_state_round_trip)
+{
+  const BoxSet set{std::vector<core::Length>(4, 0_len)};
+  const auto& boxes = set.boxes;
+
+  const auto box = [&boxes](const size_t index)
+  {
+    return gsl::not_null{&boxes[index]};
+  };
+
+  engine::ai::PathFinder::SearchState state;
+  state.expansions = {box(1), box(2)};
+  state.deferred = {box(3)};
+  state.reachable = {{box(0), true}, {box(1), false}, {box(2), true}};
+  state.distances = {{box(0), 0}, {box(2), 5}};
+  state.edges = {{box(2), box(0)}};
+
+  engine::ai::PathFinder pathFinder;
+  pathFinder.setSearchState(state, boxes.size());
+  const auto restored = pathFinder.getSearchState(boxes);
+  BOOST_CHECK(restored.expansions == state.expansions);
+  BOOST_CHECK(restored.deferred == state.deferred);
+  BOOST_CHECK(restored.reachable == state.reachable);
+  BOOST_CHECK(restored.distances == state.distances);
+  BOOST_CHECK(restored.edges == state.edges);
+
+  BOOST_CHECK(!pathFinder.isUnreachable(box(0)));
+  BOOST_CHECK(pathFinder.isUnreachable(box(1)));
+  BOOST_CHECK(!pathFinder.isUnreachable(box(3)));
+  BOOST_CHECK(pathFinder.getNextPathBox(box(2)) == &boxes[0]);
+  BOOST_CHECK(pathFinder.getNextPathBox(box(0)) == nullptr);
+
+  // restoring a state discards the previous one
+  pathFinder.setSearchState({}, boxes.size());
+  const auto cleared = pathFinder.getSearchState(boxes);
+  BOOST_CHECK(cleared.expansions.empty());
+  BOOST_CHECK(cleared.deferred.empty());
+  BOOST_CHECK(cleared.reachable.empty());
+  BOOST_CHECK(!pathFinder.isUnreachable(box(1)));
+}
+
+BOOST_AUTO_TEST_CASE(test_split_update_matches_serial_update)
+{
+  util::WorkerPool pool{4};
+  for(uint32_t seed = 0; seed < 50; ++seed)
+  {
+    UpdateReplay expected{seed};
+    for(size_t i = 0; i < UpdateReplay::ObjectCount; ++i)
+    {
+      if(expected.isSplit[i])
+      {
+        expected.updateParallel(i);
+        expected.commitUpdate(i);
+      }
+      else
+      {
+        expected.update(i);
+      }
+    }
+
+    // repeated frames must give the same results regardless of thread scheduling
+    for(int frame = 0; frame < 3; ++frame)
+    {
+      UpdateReplay actual{seed};
+      replayUpdates(pool, actual);
+      BOOST_CHECK_EQUAL(actual.world, expected.world);
+      BOOST_CHECK(actual.values == expected.values);
+      BOOST_CHECK(actual.log == expected.log);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
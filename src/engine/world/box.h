@@ -7,7 +7,6 @@
 
 #include <cstdint>
 #include <gsl/gsl-lite.hpp>
-#include <vector>
 
 namespace engine::world
 {
@@ -15,40 +14,59 @@ class World;
 
 using ZoneId = uint32_t;
 
-struct Box
+struct BoxZones
 {
-  core::Interval<core::Length> xInterval{0_len, 0_len};
-  core::Interval<core::Length> zInterval{0_len, 0_len};
-
-  core::Length floor = 0_len;
-
-  mutable bool blocked = true;
-  bool blockable = true;
-
-  std::vector<gsl::not_null<Box*>> overlaps{};
+  ZoneId fly = 0;
+  ZoneId flySwapped = 0;
+  ZoneId ground1 = 0;
+  ZoneId ground1Swapped = 0;
+  ZoneId ground2 = 0;
+  ZoneId ground2Swapped = 0;
 
-  ZoneId zoneFly = 0;
-  ZoneId zoneFlySwapped = 0;
-  ZoneId zoneGround1 = 0;
-  ZoneId zoneGround1Swapped = 0;
-  ZoneId zoneGround2 = 0;
-  ZoneId zoneGround2Swapped = 0;
-
-  static const ZoneId Box::*getZoneRef(const bool swapped, bool isFlying, const core::Length& step)
+  static const ZoneId BoxZones::*getZoneRef(const bool swapped, bool isFlying, const core::Length& step)
   {
     if(isFlying)
     {
-      return swapped ? &Box::zoneFlySwapped : &Box::zoneFly;
+      return swapped ? &BoxZones::flySwapped : &BoxZones::fly;
     }
     else if(step == core::QuarterSectorSize)
     {
-      return swapped ? &Box::zoneGround1Swapped : &Box::zoneGround1;
+      return swapped ? &BoxZones::ground1Swapped : &BoxZones::ground1;
     }
     else
     {
-      return swapped ? &Box::zoneGround2Swapped : &Box::zoneGround2;
+      return swapped ? &BoxZones::ground2Swapped : &BoxZones::ground2;
     }
   }
+};
+
+//! @brief An entry of the level-wide box adjacency list.
+//! @details Contains a copy of the static data of the overlapping box needed during path expansion, so that the
+//!          pathfinder does not need to dereference the box itself for rejecting it.
+struct BoxOverlap
+{
+  uint32_t boxIndex = 0;
+  core::Length floor = 0_len;
+  BoxZones zones{};
+};
+
+struct Box
+{
+  //! @brief Index of this box within the level's box list
+  uint32_t index = 0;
+
+  core::Interval<core::Length> xInterval{0_len, 0_len};
+  core::Interval<core::Length> zInterval{0_len, 0_len};
+
+  core::Length floor = 0_len;
+
+  mutable bool blocked = true;
+  bool blockable = true;
+
+  //! @brief Slice of the level-wide adjacency list, containing all boxes overlapping with this one
+  gsl::span<const BoxOverlap> overlaps{};
+
+  BoxZones zones{};
 
   void serialize(const serialization::Serializer<World>& ser);
 };
@@ -0,0 +1,166 @@
+#include "boxregiongraph.h"
+
+#include <algorithm>
+#include <gsl/gsl-lite.hpp>
+#include <limits>
+#include <utility>
+
+namespace engine::world
+{
+BoxRegionGraph::BoxRegionGraph(const std::vector<Box>& boxes,
+                               const ZoneId BoxZones::*zoneRef,
+                               const core::Length& step,
+                               const core::Length& drop)
+{
+  // mirrors the expansion rules of the path finder, without the runtime blocking state
+  const auto isEdge = [zoneRef, &step, &drop](const Box& from, const BoxOverlap& to)
+  {
+    if(to.boxIndex == from.index || from.zones.*zoneRef != to.zones.*zoneRef)
+      return false;
+
+    const auto heightDiff = to.floor - from.floor;
+    return heightDiff <= step && heightDiff >= drop;
+  };
+
+  // iterative variant of Tarjan's algorithm for strongly connected components
+  static constexpr auto Unvisited = std::numeric_limits<uint32_t>::max();
+  std::vector<uint32_t> order(boxes.size(), Unvisited);
+  std::vector<uint32_t> lowLink(boxes.size(), 0);
+  std::vector<bool> onStack(boxes.size(), false);
+  std::vector<uint32_t> stack;
+  // box index and the next overlap to be processed
+  std::vector<std::pair<uint32_t, size_t>> callStack;
+  m_boxRegions.resize(boxes.size(), 0);
+  uint32_t nextOrder = 0;
+  RegionId nextRegion = 0;
+
+  for(uint32_t root = 0; root < boxes.size(); ++root)
+  {
+    if(order[root] != Unvisited)
+      continue;
+
+    callStack.emplace_back(root, 0);
+    while(!callStack.empty())
+    {
+      auto& [boxIndex, overlapIndex] = callStack.back();
+      const auto& box = boxes[boxIndex];
+      if(overlapIndex == 0 && order[boxIndex] == Unvisited)
+      {
+        order[boxIndex] = lowLink[boxIndex] = nextOrder++;
+        stack.emplace_back(boxIndex);
+        onStack[boxIndex] = true;
+      }
+
+      bool descended = false;
+      while(overlapIndex < box.overlaps.size())
+      {
+        const auto& overlap = box.overlaps[overlapIndex++];
+        if(!isEdge(box, overlap))
+          continue;
+
+        if(order[overlap.boxIndex] == Unvisited)
+        {
+          callStack.emplace_back(overlap.boxIndex, 0);
+          descended = true;
+          break;
+        }
+
+        if(onStack[overlap.boxIndex])
+          lowLink[boxIndex] = std::min(lowLink[boxIndex], order[overlap.boxIndex]);
+      }
+
+      if(descended)
+        continue;
+
+      const auto finished = boxIndex;
+      if(lowLink[finished] == order[finished])
+      {
+        while(true)
+        {
+          const auto member = stack.back();
+          stack.pop_back();
+          onStack[member] = false;
+          m_boxRegions[member] = nextRegion;
+          if(member == finished)
+            break;
+        }
+        ++nextRegion;
+      }
+
+      callStack.pop_back();
+      if(!callStack.empty())
+      {
+        const auto parent = callStack.back().first;
+        lowLink[parent] = std::min(lowLink[parent], lowLink[finished]);
+      }
+    }
+  }
+
+  m_successors.resize(nextRegion);
+  m_predecessors.resize(nextRegion);
+  for(const auto& box : boxes)
+  {
+    const auto from = m_boxRegions[box.index];
+    for(const auto& overlap : box.overlaps)
+    {
+      if(!isEdge(box, overlap))
+        continue;
+
+      const auto to = m_boxRegions[overlap.boxIndex];
+      if(from == to)
+        continue;
+
+      m_successors[from].emplace_back(to);
+      m_predecessors[to].emplace_back(from);
+    }
+  }
+
+  for(auto* edges : {&m_successors, &m_predecessors})
+  {
+    for(auto& regionEdges : *edges)
+    {
+      std::sort(regionEdges.begin(), regionEdges.end());
+      regionEdges.erase(std::unique(regionEdges.begin(), regionEdges.end()), regionEdges.end());
+    }
+  }
+}
+
+bool BoxRegionGraph::canReach(const RegionId from, const RegionId to) const
+{
+  return getClosure(m_descendants, m_successors, from).at(to);
+}
+
+bool BoxRegionGraph::isBetween(const RegionId region, const RegionId from, const RegionId to) const
+{
+  return getClosure(m_descendants, m_successors, from).at(region)
+         && getClosure(m_ancestors, m_predecessors, to).at(region);
+}
+
+const std::vector<bool>& BoxRegionGraph::getClosure(std::unordered_map<RegionId, std::vector<bool>>& cache,
+                                                    const std::vector<std::vector<RegionId>>& edges,
+                                                    const RegionId region)
+{
+  Expects(region < edges.size());
+  if(const auto it = cache.find(region); it != cache.end())
+    return it->second;
+
+  std::vector<bool> closure(edges.size(), false);
+  std::vector<RegionId> pending{region};
+  closure[region] = true;
+  while(!pending.empty())
+  {
+    const auto current = pending.back();
+    pending.pop_back();
+    for(const auto next : edges[current])
+    {
+      if(closure[next])
+        continue;
+
+      closure[next] = true;
+      pending.emplace_back(next);
+    }
+  }
+
+  return cache.emplace(region, std::move(closure)).first->second;
+}
+} // namespace engine::world
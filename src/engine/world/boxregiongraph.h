@@ -0,0 +1,59 @@
+#pragma once
+
+#include "box.h"
+#include "core/units.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::world
+{
+//! @brief Coarse connectivity of the box graph for a single set of pathfinder movement limits.
+//! @details Boxes are grouped into regions, which are the strongly connected components of the box graph as the
+//!          path finder traverses it, ignoring the runtime blocking state of the boxes. The regions form a directed
+//!          acyclic graph, which allows to determine whether a path search can ever succeed, and which regions may
+//!          contain boxes of a path at all.
+class BoxRegionGraph final
+{
+public:
+  using RegionId = uint32_t;
+
+  explicit BoxRegionGraph(const std::vector<Box>& boxes,
+                          const ZoneId BoxZones::*zoneRef,
+                          const core::Length& step,
+                          const core::Length& drop);
+
+  [[nodiscard]] RegionId getRegion(const Box& box) const
+  {
+    return m_boxRegions.at(box.index);
+  }
+
+  [[nodiscard]] size_t getRegionCount() const noexcept
+  {
+    return m_successors.size();
+  }
+
+  //! @brief Whether a path search starting in @a from can ever reach @a to
+  [[nodiscard]] bool canReach(RegionId from, RegionId to) const;
+
+  //! @brief Whether @a region can contain boxes on a path from @a from to @a to
+  [[nodiscard]] bool isBetween(RegionId region, RegionId from, RegionId to) const;
+
+private:
+  std::vector<RegionId> m_boxRegions;
+  std::vector<std::vector<RegionId>> m_successors;
+  std::vector<std::vector<RegionId>> m_predecessors;
+
+  //! @brief Lazily evaluated transitive closures of the region graph
+  //! @{
+  mutable std::unordered_map<RegionId, std::vector<bool>> m_descendants;
+  mutable std::unordered_map<RegionId, std::vector<bool>> m_ancestors;
+  //! @}
+
+  [[nodiscard]] static const std::vector<bool>& getClosure(std::unordered_map<RegionId, std::vector<bool>>& cache,
+                                                           const std::vector<std::vector<RegionId>>& edges,
+                                                           RegionId region);
+};
+} // namespace engine::world
@@ -25,9 +25,13 @@
 #include <gl/renderstate.h>
 #include <gl/vertexarray.h>
 #include <gl/vertexbuffer.h>
+#include <glm/common.hpp>
+#include <glm/mat3x3.hpp>
+#include <glm/mat4x4.hpp>
 #include <glm/vec2.hpp>
 #include <gslu.h>
 #include <initializer_list>
+#include <limits>
 
 namespace gl
 {
@@ -207,6 +211,47 @@ RenderMeshData::RenderMeshData(const loader::file::Mesh& mesh,
   }
 }
 
+void RenderMeshDataCompositor::append(const RenderMeshData& data, const glm::mat4& transform)
+{
+  const auto vertexOffset = gsl::narrow<RenderMeshData::IndexType>(m_vertices.size());
+  const glm::mat3 normalTransform{transform};
+  const auto transformPosition = [&transform](const glm::vec3& position)
+  {
+    return glm::vec3{transform * glm::vec4{position, 1.0f}};
+  };
+
+  for(auto v : data.getVertices())
+  {
+    v.position = transformPosition(v.position);
+    v.normal = normalTransform * v.normal;
+    v.quadVert1 = transformPosition(v.quadVert1);
+    v.quadVert2 = transformPosition(v.quadVert2);
+    v.quadVert3 = transformPosition(v.quadVert3);
+    v.quadVert4 = transformPosition(v.quadVert4);
+    v.boneIndex = m_boneIndex;
+    v.reflective = glm::vec4{0.0f};
+    m_vertices.emplace_back(v);
+  }
+
+  for(auto i : data.getIndices())
+  {
+    // cppcheck-suppress useStlAlgorithm
+    m_indices.emplace_back(gsl::narrow<RenderMeshData::IndexType>(i + vertexOffset));
+  }
+}
+
+std::tuple<glm::vec3, glm::vec3> RenderMeshDataCompositor::getBounds() const
+{
+  glm::vec3 min{std::numeric_limits<float>::max()};
+  glm::vec3 max{std::numeric_limits<float>::lowest()};
+  for(const auto& v : m_vertices)
+  {
+    min = glm::min(min, v.position);
+    max = glm::max(max, v.position);
+  }
+  return {min, max};
+}
+
 gslu::nn_shared<render::scene::Mesh> RenderMeshDataCompositor::toMesh(render::scene::MaterialManager& materialManager,
                                                                       bool skeletal,
                                                                       bool shadowCaster,
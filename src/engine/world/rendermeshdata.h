@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <gl/api/gl.hpp>
 #include <gl/pixel.h>
@@ -16,6 +17,7 @@
 #include <gslu.h>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace render::scene
@@ -117,6 +119,9 @@ public:
     ++m_boneIndex;
   }
 
+  //! @brief Appends @p data with its geometry transformed by @p transform, without occupying a bone slot
+  void append(const RenderMeshData& data, const glm::mat4& transform);
+
   void appendEmpty()
   {
     ++m_boneIndex;
@@ -130,6 +135,14 @@ public:
     return m_vertices.empty() || m_indices.empty();
   }
 
+  [[nodiscard]] size_t getVertexCount() const
+  {
+    return m_vertices.size();
+  }
+
+  //! @brief Minimum and maximum of the appended vertex positions
+  [[nodiscard]] std::tuple<glm::vec3, glm::vec3> getBounds() const;
+
 private:
   std::vector<RenderMeshData::RenderVertex> m_vertices{};
   std::vector<RenderMeshData::IndexType> m_indices{};
@@ -3,17 +3,18 @@
 #include "atlastile.h"
 #include "box.h"
 #include "core/angle.h"
+#include "core/boundingbox.h"
 #include "core/containeroffset.h"
 #include "core/genericvec.h"
-#include "core/i18n.h"
 #include "core/id.h"
+#include "core/interval.h"
 #include "engine/engine.h"
 #include "engine/engineconfig.h"
 #include "engine/lighting.h"
 #include "engine/location.h"
+#include "engine/objectmanager.h"
 #include "engine/objects/object.h"
 #include "engine/objects/objectstate.h"
-#include "engine/presenter.h"
 #include "loader/file/datatypes.h"
 #include "loader/file/primitives.h"
 #include "loader/file/texture.h"
@@ -26,7 +27,9 @@
 #include "render/scene/node.h"
 #include "render/scene/rendermode.h"
 #include "render/scene/shaderprogram.h"
+#include "render/scene/sprite.h"
 #include "render/textureanimator.h"
+#include "rendermeshdata.h"
 #include "sector.h"
 #include "serialization/serialization.h"
 #include "serialization/vector.h"
@@ -36,8 +39,10 @@
 #include "util.h"
 #include "world.h"
 
+#include <algorithm>
 #include <boost/assert.hpp>
 #include <boost/log/trivial.hpp>
+#include <cmath>
 #include <cstdint>
 #include <exception>
 #include <gl/buffer.h>
@@ -52,15 +57,21 @@
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
+#include <glm/vector_relational.hpp>
 #include <gslu.h>
 #include <initializer_list>
 #include <iosfwd>
 #include <iterator>
 #include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace engine::world
 {
@@ -158,6 +169,61 @@ core::TRVec getCenter(const std::array<loader::file::VertexIndex, N>& faceVertic
 
   return s / static_cast<core::Length::type>(N);
 }
+
+//! @brief The dust shader derives the particle positions from the vertex id, so its meshes only consist of an index
+//!        buffer; they are shared between all rooms with the same particle count rounded up to a power of two
+gslu::nn_shared<render::scene::Mesh> getDustMesh(uint32_t particleCount,
+                                                 const gslu::nn_shared<render::scene::Material>& dustMaterial)
+{
+  uint32_t size = 1;
+  while(size < particleCount)
+    size *= 2;
+
+  static std::map<std::tuple<const render::scene::Material*, uint32_t>, std::weak_ptr<render::scene::Mesh>> meshes;
+  // drop the meshes of previous levels; as a mesh keeps its material alive, this also ensures that a material
+  // allocated at the address of a destroyed one can't hit a stale entry
+  for(auto it = meshes.begin(); it != meshes.end();)
+  {
+    if(it->second.expired())
+      it = meshes.erase(it);
+    else
+      ++it;
+  }
+
+  auto& cached = meshes[{dustMaterial.get().get(), size}];
+  if(const auto mesh = cached.lock())
+    return gsl::not_null{mesh};
+
+  const auto label = "dust-particles-" + std::to_string(size);
+
+  // the shader has no vertex inputs, but a vertex array needs a vertex buffer
+  static const gl::VertexLayout<glm::vec3> layout{
+    {VERTEX_ATTRIBUTE_POSITION_NAME, gl::VertexAttribute<glm::vec3>::Single{}}};
+  auto vbuf = gsl::make_shared<gl::VertexBuffer<glm::vec3>>(layout, label);
+  vbuf->setData(std::vector<glm::vec3>{glm::vec3{0.0f}}, gl::api::BufferUsage::StaticDraw);
+
+  std::vector<uint32_t> indices(size);
+  std::iota(indices.begin(), indices.end(), 0u);
+  auto indexBuffer = gsl::make_shared<gl::ElementArrayBuffer<uint32_t>>(label);
+  indexBuffer->setData(indices, gl::api::BufferUsage::StaticDraw);
+
+  auto vao = gsl::make_shared<gl::VertexArray<uint32_t, glm::vec3>>(
+    indexBuffer, vbuf, std::vector{&dustMaterial->getShaderProgram()->getHandle()}, label);
+  auto mesh = std::make_shared<render::scene::MeshImpl<uint32_t, glm::vec3>>(vao, gl::api::PrimitiveType::Points);
+  mesh->getMaterialGroup().set(render::scene::RenderMode::Full, dustMaterial);
+  cached = mesh;
+  return gsl::not_null{mesh};
+}
+
+//! @brief Lights contributing less than this to any point of a room are not uploaded for it
+constexpr float MinLightContribution = 1.0f / 512.0f;
+
+//! @brief The inclusive range of sector indices covered by @p interval, clamped to the room
+std::pair<int, int> getSectorRange(const core::Interval<core::Length>& interval, const core::Length& origin, int count)
+{
+  return {std::clamp(gsl::narrow_cast<int>(sectorOf(interval.min - origin)), 0, count - 1),
+          std::clamp(gsl::narrow_cast<int>(sectorOf(interval.max - origin)), 0, count - 1)};
+}
 } // namespace
 
 void Portal::buildMesh(const loader::file::Portal& srcPortal, const gslu::nn_shared<render::scene::Material>& material)
@@ -192,7 +258,7 @@ void Portal::buildMesh(const loader::file::Portal& srcPortal, const gslu::nn_sha
 void Room::createSceneNode(const loader::file::Room& srcRoom,
                            const size_t roomId,
                            World& world,
-                           render::TextureAnimator& animator,
+                           const render::TextureAnimator& animator,
                            render::scene::MaterialManager& materialManager)
 {
   RenderMesh renderMesh;
@@ -210,6 +276,7 @@ void Room::createSceneNode(const loader::file::Room& srcRoom,
     {VERTEX_ATTRIBUTE_TEXCOORD_PREFIX_NAME, gl::VertexAttribute{&render::TextureAnimator::AnimatedUV::uv}},
     {VERTEX_ATTRIBUTE_QUAD_UV12, &render::TextureAnimator::AnimatedUV::quadUv12},
     {VERTEX_ATTRIBUTE_QUAD_UV34, &render::TextureAnimator::AnimatedUV::quadUv34},
+    {VERTEX_ATTRIBUTE_TEXTURE_ANIMATION, &render::TextureAnimator::AnimatedUV::animation},
   };
   auto uvCoords = gsl::make_shared<gl::VertexBuffer<render::TextureAnimator::AnimatedUV>>(uvAttribs, label + "-uv");
 
@@ -256,7 +323,8 @@ void Room::createSceneNode(const loader::file::Room& srcRoom,
       uvCoordsData.emplace_back(tile.textureKey.tileAndFlag & loader::file::TextureIndexMask,
                                 tile.uvCoordinates[i],
                                 glm::vec4{tile.uvCoordinates[0], tile.uvCoordinates[1]},
-                                glm::vec4{tile.uvCoordinates[2], tile.uvCoordinates[3]});
+                                glm::vec4{tile.uvCoordinates[2], tile.uvCoordinates[3]},
+                                animator.getVertexAnimation(quad.tileId, i));
       if(useQuadHandling)
       {
         iv.isQuad = 1;
@@ -288,10 +356,6 @@ void Room::createSceneNode(const loader::file::Room& srcRoom,
     {
       renderMesh.m_indices.emplace_back(gsl::narrow<RenderMesh::IndexType>(firstVertex + i));
     }
-    for(int i : {0, 1, 2, 3})
-    {
-      animator.registerVertex(quad.tileId, uvCoords, i, firstVertex + i);
-    }
   }
   for(const loader::file::Triangle& tri : srcRoom.triangles)
   {
@@ -322,7 +386,8 @@ void Room::createSceneNode(const loader::file::Room& srcRoom,
       uvCoordsData.emplace_back(tile.textureKey.tileAndFlag & loader::file::TextureIndexMask,
                                 tile.uvCoordinates[i],
                                 glm::vec4{tile.uvCoordinates[0], tile.uvCoordinates[1]},
-                                glm::vec4{tile.uvCoordinates[2], tile.uvCoordinates[3]});
+                                glm::vec4{tile.uvCoordinates[2], tile.uvCoordinates[3]},
+                                animator.getVertexAnimation(tri.tileId, i));
 
       static const std::array<int, 3> indices{0, 1, 2};
       iv.normal = generateNormal(tri.vertices[indices[(i + 0) % 3]].from(srcRoom.vertices).position,
@@ -336,14 +401,10 @@ void Room::createSceneNode(const loader::file::Room& srcRoom,
     {
       renderMesh.m_indices.emplace_back(gsl::narrow<RenderMesh::IndexType>(firstVertex + i));
     }
-    for(int i : {0, 1, 2})
-    {
-      animator.registerVertex(tri.tileId, uvCoords, i, firstVertex + i);
-    }
   }
 
   vbuf->setData(vbufData, gl::api::BufferUsage::StaticDraw);
-  uvCoords->setData(uvCoordsData, gl::api::BufferUsage::DynamicDraw);
+  uvCoords->setData(uvCoordsData, gl::api::BufferUsage::StaticDraw);
 
   auto resMesh = renderMesh.toMesh(vbuf, uvCoords, label);
   resMesh->getRenderState().setCullFace(true);
@@ -365,15 +426,37 @@ void Room::createSceneNode(const loader::file::Room& srcRoom,
                shaderStorageBlock.bind(*emptyBuffer);
              });
 
-  for(const RoomStaticMesh& sm : staticMeshes)
+  node->bind("b_textureAnimationTiles",
+             [tilesBuffer = animator.getTilesBuffer()](const render::scene::Node*,
+                                                       const render::scene::Mesh& /*mesh*/,
+                                                       gl::ShaderStorageBlock& shaderStorageBlock)
+             {
+               shaderStorageBlock.bind(*tilesBuffer);
+             });
+  node->bind("u_textureAnimationStep",
+             [animator = &animator](
+               const render::scene::Node* /*node*/, const render::scene::Mesh& /*mesh*/, gl::Uniform& uniform)
+             {
+               uniform.set(animator->getStep());
+             });
+
+  // all static meshes of a room share its lighting, so they are baked into one draw per spatial cell; this keeps the
+  // draw count low while still allowing the cells to be occlusion culled individually
+  RenderMeshDataCompositor staticMeshCompositor;
+  const auto flushStaticMeshes = [this, &staticMeshCompositor, &materialManager, &label]()
   {
-    if(sm.staticMesh->renderMesh == nullptr)
-      continue;
+    if(staticMeshCompositor.empty())
+      return;
 
-    auto subNode = std::make_shared<render::scene::Node>("staticMesh");
-    subNode->setRenderable(sm.staticMesh->renderMesh);
-    subNode->setLocalMatrix(translate(glm::mat4{1.0f}, (sm.position - position).toRenderSystem())
-                            * rotate(glm::mat4{1.0f}, toRad(sm.rotation), glm::vec3{0, -1, 0}));
+    auto mesh = staticMeshCompositor.toMesh(
+      materialManager, false, false, label + "-static-" + std::to_string(sceneryNodes.size()));
+    mesh->getRenderState().setScissorTest(false);
+    const auto [boundsMin, boundsMax] = staticMeshCompositor.getBounds();
+    staticMeshCompositor = RenderMeshDataCompositor{};
+
+    auto subNode = std::make_shared<render::scene::Node>("staticMeshes");
+    subNode->setRenderable(mesh);
+    subNode->setLocalBounds(boundsMin, boundsMax);
 
     subNode->bind("u_lightAmbient",
                   [brightness = toBrightness(ambientShade)](
@@ -391,24 +474,95 @@ void Room::createSceneNode(const loader::file::Room& srcRoom,
                   });
 
     sceneryNodes.emplace_back(std::move(subNode));
+  };
+
+  static constexpr auto StaticMeshCellSize = 4_sectors;
+  const auto getStaticMeshCell = [this](const RoomStaticMesh& sm) -> std::tuple<core::Length::type, core::Length::type>
+  {
+    return {(sm.position.X - position.X) / StaticMeshCellSize,
+            (sm.position.Z - position.Z) / StaticMeshCellSize};
+  };
+
+  std::vector<const RoomStaticMesh*> sortedStaticMeshes;
+  sortedStaticMeshes.reserve(staticMeshes.size());
+  for(const RoomStaticMesh& sm : staticMeshes)
+    sortedStaticMeshes.emplace_back(&sm);
+  std::stable_sort(sortedStaticMeshes.begin(),
+                   sortedStaticMeshes.end(),
+                   [&getStaticMeshCell](const RoomStaticMesh* a, const RoomStaticMesh* b)
+                   {
+                     return getStaticMeshCell(*a) < getStaticMeshCell(*b);
+                   });
+
+  std::optional<std::tuple<core::Length::type, core::Length::type>> currentCell;
+  for(const RoomStaticMesh* smPtr : sortedStaticMeshes)
+  {
+    const RoomStaticMesh& sm = *smPtr;
+    const auto& meshData = sm.staticMesh->renderMeshData;
+    if(meshData == nullptr)
+      continue;
+
+    const auto cell = getStaticMeshCell(sm);
+    if(cell != currentCell
+       || staticMeshCompositor.getVertexCount() + meshData->getVertices().size()
+            > size_t{std::numeric_limits<RenderMeshData::IndexType>::max()} + 1)
+    {
+      flushStaticMeshes();
+      currentCell = cell;
+    }
+
+    staticMeshCompositor.append(*meshData,
+                                translate(glm::mat4{1.0f}, (sm.position - position).toRenderSystem())
+                                  * rotate(glm::mat4{1.0f}, toRad(sm.rotation), glm::vec3{0, -1, 0}));
   }
+  flushStaticMeshes();
   node->setLocalMatrix(translate(glm::mat4{1.0f}, position.toRenderSystem()));
 
+  // room sprites of the same kind are drawn in a single instanced draw, with their room-relative position and their
+  // brightness stored per instance
+  std::map<size_t, std::vector<render::scene::SpriteInstance>> spriteInstances;
   for(const loader::file::SpriteInstance& spriteInstance : srcRoom.sprites)
   {
     BOOST_ASSERT(spriteInstance.vertex.get() < srcRoom.vertices.size());
 
-    const auto& sprite = world.getSprites().at(spriteInstance.id.get());
-
-    auto spriteNode = std::make_shared<render::scene::Node>("sprite");
-    spriteNode->setRenderable(sprite.yBoundMesh);
     const auto& v = srcRoom.vertices.at(spriteInstance.vertex.get());
-    spriteNode->setLocalMatrix(translate(glm::mat4{1.0f}, v.position.toRenderSystem()));
+    spriteInstances[spriteInstance.id.get()].emplace_back(
+      world.getSprites().at(spriteInstance.id.get()).toSpriteFrame(),
+      translate(glm::mat4{1.0f}, v.position.toRenderSystem()),
+      toBrightness(v.shade).get());
+  }
+
+  for(const auto& [spriteId, instances] : spriteInstances)
+  {
+    const auto& sprite = world.getSprites().at(spriteId);
+
+    auto instanceBuffer = std::make_shared<gl::ShaderStorageBuffer<render::scene::SpriteInstance>>(
+      label + "-sprite-instances");
+    instanceBuffer->setData(instances, gl::api::BufferUsage::StaticDraw);
+
+    auto mesh = render::scene::createInstancedSpriteMesh(materialManager.getSprite(false, true),
+                                                         label + "-sprite-" + std::to_string(spriteId));
+    mesh->setInstanceCount(gsl::narrow<gl::api::core::SizeType>(instances.size()));
+
+    // y-bound sprites rotate around the vertical axis, so their horizontal extent is covered in both directions
+    const auto radius = static_cast<float>(std::max(std::abs(sprite.render0.x), std::abs(sprite.render1.x)));
+    glm::vec3 boundsMin{std::numeric_limits<float>::max()};
+    glm::vec3 boundsMax{std::numeric_limits<float>::lowest()};
+    for(const auto& instance : instances)
+    {
+      boundsMin = glm::min(boundsMin, glm::vec3{instance.transform[3]} - glm::vec3{radius, 0, radius});
+      boundsMax = glm::max(boundsMax, glm::vec3{instance.transform[3]} + glm::vec3{radius, 0, radius});
+    }
+    boundsMin.y += static_cast<float>(std::min(-sprite.render0.y, -sprite.render1.y));
+    boundsMax.y += static_cast<float>(std::max(-sprite.render0.y, -sprite.render1.y));
+
+    auto spriteNode = std::make_shared<render::scene::Node>("sprites");
+    spriteNode->setRenderable(mesh);
+    spriteNode->setLocalBounds(boundsMin, boundsMax);
     spriteNode->bind("u_lightAmbient",
-                     [brightness = toBrightness(v.shade)](
-                       const render::scene::Node* /*node*/, const render::scene::Mesh& /*mesh*/, gl::Uniform& uniform)
+                     [](const render::scene::Node* /*node*/, const render::scene::Mesh& /*mesh*/, gl::Uniform& uniform)
                      {
-                       uniform.set(brightness.get());
+                       uniform.set(1.0f);
                      });
     spriteNode->bind("b_lights",
                      [emptyLightsBuffer = ShaderLight::getEmptyBuffer()](const render::scene::Node*,
@@ -417,6 +571,13 @@ void Room::createSceneNode(const loader::file::Room& srcRoom,
                      {
                        shaderStorageBlock.bind(*emptyLightsBuffer);
                      });
+    spriteNode->bind("b_instances",
+                     [instanceBuffer](const render::scene::Node*,
+                                      const render::scene::Mesh& /*mesh*/,
+                                      gl::ShaderStorageBlock& shaderStorageBlock)
+                     {
+                       shaderStorageBlock.bind(*instanceBuffer);
+                     });
 
     sceneryNodes.emplace_back(std::move(spriteNode));
   }
@@ -437,8 +598,6 @@ void Room::createSceneNode(const loader::file::Room& srcRoom,
                    return p;
                  });
 
-  collectShaderLights(world.getEngine().getEngineConfig()->renderSettings.getLightCollectionDepth());
-
   for(const auto& v : srcRoom.vertices)
   {
     const auto vv = v.position.toRenderSystem();
@@ -446,14 +605,72 @@ void Room::createSceneNode(const loader::file::Room& srcRoom,
     verticesBBoxMax = glm::max(verticesBBoxMax, vv);
   }
 
-  regenerateDust(nullptr,
-                 materialManager.getDustParticle(),
+  // needs the vertex bounding box to cull lights
+  collectShaderLights(world.getEngine().getEngineConfig()->renderSettings.getLightCollectionDepth());
+
+  regenerateDust(materialManager.getDustParticle(),
                  world.getEngine().getEngineConfig()->renderSettings.dustActive,
                  world.getEngine().getEngineConfig()->renderSettings.dustDensity);
 
   resetScenery();
 }
 
+void Room::initStaticMeshColliders()
+{
+  staticMeshColliders.clear();
+  for(const auto& rsm : staticMeshes)
+  {
+    if(!rsm.staticMesh->doNotCollide)
+      staticMeshColliders.emplace_back(rotateTranslate(rsm.staticMesh->collisionBox, rsm.position, rsm.rotation));
+  }
+
+  // colliders are binned into the sectors they overlap; the bins are stored contiguously, in collider order
+  const auto cellCount = gsl::narrow<size_t>(sectorCountX * sectorCountZ);
+  std::vector<std::vector<uint32_t>> cells(cellCount);
+  for(size_t i = 0; i < staticMeshColliders.size(); ++i)
+  {
+    const auto& box = staticMeshColliders[i];
+    const auto [x0, x1] = getSectorRange(box.x, position.X, sectorCountX);
+    const auto [z0, z1] = getSectorRange(box.z, position.Z, sectorCountZ);
+    for(int x = x0; x <= x1; ++x)
+      for(int z = z0; z <= z1; ++z)
+        cells[sectorCountZ * x + z].emplace_back(gsl::narrow<uint32_t>(i));
+  }
+
+  staticMeshColliderCellStarts.clear();
+  staticMeshColliderCellStarts.reserve(cellCount + 1);
+  staticMeshColliderCells.clear();
+  for(const auto& cell : cells)
+  {
+    staticMeshColliderCellStarts.emplace_back(gsl::narrow<uint32_t>(staticMeshColliderCells.size()));
+    staticMeshColliderCells.insert(staticMeshColliderCells.end(), cell.begin(), cell.end());
+  }
+  staticMeshColliderCellStarts.emplace_back(gsl::narrow<uint32_t>(staticMeshColliderCells.size()));
+}
+
+void Room::collectStaticMeshColliders(const core::BoundingBox& box, std::vector<uint32_t>& indices) const
+{
+  indices.clear();
+  if(staticMeshColliders.empty())
+    return;
+
+  const auto [x0, x1] = getSectorRange(box.x, position.X, sectorCountX);
+  const auto [z0, z1] = getSectorRange(box.z, position.Z, sectorCountZ);
+  for(int x = x0; x <= x1; ++x)
+  {
+    for(int z = z0; z <= z1; ++z)
+    {
+      const auto cell = gsl::narrow<size_t>(sectorCountZ * x + z);
+      indices.insert(indices.end(),
+                     staticMeshColliderCells.begin() + staticMeshColliderCellStarts[cell],
+                     staticMeshColliderCells.begin() + staticMeshColliderCellStarts[cell + 1]);
+    }
+  }
+
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
+
 void patchHeightsForBlock(const engine::objects::Object& object, const core::Length& height)
 {
   auto tmp = object.m_state.location;
@@ -474,6 +691,7 @@ void patchHeightsForBlock(const engine::objects::Object& object, const core::Len
 
   if(groundSector->box != nullptr && groundSector->box->blockable)
     groundSector->box->blocked = (height < 0_len);
+  object.getWorld().getObjectManager().invalidateLineOfSightCache();
 }
 
 std::optional<core::Length> getWaterSurfaceHeight(const Location& location)
@@ -541,15 +759,8 @@ const Sector* Room::getSectorByIndex(const int dx, const int dz) const
   return &sectors[sectorCountZ * dx + dz];
 }
 
-void Room::collectShaderLights(size_t depth)
+std::set<gsl::not_null<const Room*>> Room::getLightCollectionRooms(size_t depth) const
 {
-  bufferLights.clear();
-  if(lights.empty())
-  {
-    lightsBuffer->setData(bufferLights, gl::api::BufferUsage::StaticDraw);
-    return;
-  }
-
   std::set<gsl::not_null<const Room*>> testRooms;
   testRooms.emplace(this);
   for(size_t i = 0; i < depth; ++i)
@@ -566,7 +777,30 @@ void Room::collectShaderLights(size_t depth)
     testRooms = std::move(newTestRooms);
   }
 
-  for(const auto& room : testRooms)
+  return testRooms;
+}
+
+void Room::collectShaderLights(size_t depth)
+{
+  collectShaderLights(getLightCollectionRooms(depth));
+}
+
+void Room::collectShaderLights(const std::set<gsl::not_null<const Room*>>& lightRooms)
+{
+  bufferLights.clear();
+  if(lights.empty())
+  {
+    lightsBuffer->setData(bufferLights, gl::api::BufferUsage::StaticDraw);
+    return;
+  }
+
+  // objects may reach out of the room geometry a bit, so lights are culled against a slightly enlarged box
+  const bool hasBBox = glm::all(glm::lessThanEqual(verticesBBoxMin, verticesBBoxMax));
+  const auto lightCullMargin = glm::vec3{(1_sectors).get<float>()};
+  const auto lightCullMin = verticesBBoxMin + position.toRenderSystem() - lightCullMargin;
+  const auto lightCullMax = verticesBBoxMax + position.toRenderSystem() + lightCullMargin;
+
+  for(const auto& room : lightRooms)
   {
     // http://www-f9.ijs.si/~matevz/docs/PovRay/pov274.htm
     // 1 / ( 1 + (d/fade_distance) ^ fade_power );
@@ -577,104 +811,86 @@ void Room::collectShaderLights(size_t depth)
     {
       if(light.intensity.get() <= 0)
         continue;
-      bufferLights.emplace_back(ShaderLight{glm::vec4{light.position.toRenderSystem(), 0.0f},
-                                            toBrightness(light.intensity).get(),
-                                            light.fadeDistance.get<float>()});
+
+      const auto lightPosition = light.position.toRenderSystem();
+      const auto brightness = toBrightness(light.intensity).get();
+      const auto fadeDistance = light.fadeDistance.get<float>();
+      if(hasBBox && fadeDistance > 0)
+      {
+        // skip lights that cannot contribute a visible amount anywhere within the room
+        const auto r = glm::distance(lightPosition, glm::clamp(lightPosition, lightCullMin, lightCullMax)) / fadeDistance;
+        if(brightness / (r * r + 1) < MinLightContribution)
+          continue;
+      }
+
+      bufferLights.emplace_back(ShaderLight{glm::vec4{lightPosition, 0.0f}, brightness, fadeDistance});
     }
   }
 
   lightsBuffer->setData(bufferLights, gl::api::BufferUsage::StaticDraw);
 }
 
-void Room::regenerateDust(const std::shared_ptr<engine::Presenter>& presenter,
-                          const gslu::nn_shared<render::scene::Material>& dustMaterial,
+void Room::regenerateDust(const gslu::nn_shared<render::scene::Material>& dustMaterial,
                           bool isDustEnabled,
                           uint8_t dustDensityDivisor)
 {
+  dust = nullptr;
   if(!isDustEnabled)
-  {
-    dust = nullptr;
-    return;
-  }
-
-  if(const auto it = dustCache.find(dustDensityDivisor); it != dustCache.end())
-  {
-    dust = it->second;
     return;
-  }
-  if(presenter != nullptr)
-    presenter->drawLoadingScreen(_("Generating Dust Particles..."));
-  auto dustNode
-    = createParticleMesh(node->getName() + "/dust", verticesBBoxMin, verticesBBoxMax, dustMaterial, dustDensityDivisor);
-  dustCache.emplace(dustDensityDivisor, dustNode);
-  dust = dustNode;
-}
 
-std::shared_ptr<render::scene::Node>
-  Room::createParticleMesh(const std::string& label,
-                           const glm::vec3& min,
-                           const glm::vec3& max,
-                           const gslu::nn_shared<render::scene::Material>& dustMaterial,
-                           uint8_t dustDensityDivisor)
-{
   static const constexpr auto BaseGridAxisSubdivision = 12;
   const auto resolution = (cbrt(dustDensityDivisor) / BaseGridAxisSubdivision * 1_sectors).cast<float>().get();
 
-  // https://stackoverflow.com/a/3747462
-  static const auto fastrand = []()
+  const auto countCells = [resolution](float min, float max)
   {
-    static uint32_t seed = 12345;
-    seed = (214013 * seed + 2531011);
-    return static_cast<float>(seed >> 16u) / 0x8000 - 0.5f;
+    uint32_t count = 0;
+    for(float x = min + resolution; x < max - resolution; x += resolution)
+      ++count;
+    return count;
   };
 
-  std::vector<glm::vec3> vertices;
-  vertices.reserve(std::lround(std::max(0.0f,
-                                        ((max.x - min.x) / resolution - 2) * ((max.y - min.y) / resolution - 2)
-                                          * ((max.z - min.z) / resolution - 2))));
-  std::vector<uint32_t> indices;
-  indices.reserve(vertices.capacity());
-  BOOST_LOG_TRIVIAL(debug) << "generating " << vertices.capacity() << " particles for " << label;
-
-  for(float x = min.x + resolution; x < max.x - resolution; x += resolution)
-  {
-    for(float y = min.y + resolution; y < max.y - resolution; y += resolution)
-    {
-      for(float z = min.z + resolution; z < max.z - resolution; z += resolution)
-      {
-        glm::vec3 p0 = glm::vec3{x, y, z};
-        glm::vec3 offset{fastrand() * resolution, fastrand() * resolution, fastrand() * resolution};
-        vertices.emplace_back(p0 + offset);
-        indices.emplace_back(gsl::narrow_cast<uint32_t>(vertices.size()));
-      }
-    }
-  }
-
-  static const gl::VertexLayout<glm::vec3> layout{
-    {VERTEX_ATTRIBUTE_POSITION_NAME, gl::VertexAttribute<glm::vec3>::Single{}}};
-
-  auto vbuf = gsl::make_shared<gl::VertexBuffer<glm::vec3>>(layout, label + "-particles");
-  vbuf->setData(vertices, gl::api::BufferUsage::StaticDraw);
-  auto indexBuffer = gsl::make_shared<gl::ElementArrayBuffer<uint32_t>>(label + "-particles");
-  indexBuffer->setData(indices, gl::api::BufferUsage::StaticDraw);
-
-  auto vao = gsl::make_shared<gl::VertexArray<uint32_t, glm::vec3>>(
-    indexBuffer, vbuf, std::vector{&dustMaterial->getShaderProgram()->getHandle()}, label + "-particles");
-  auto mesh = std::make_shared<render::scene::MeshImpl<uint32_t, glm::vec3>>(vao, gl::api::PrimitiveType::Points);
-  mesh->getMaterialGroup().set(render::scene::RenderMode::Full, dustMaterial);
-
-  mesh->bind("u_baseColor",
-             [color = isWaterRoom ? glm::vec3{0.146f, 0.485f, 0.216f} : glm::vec3{0.431f, 0.386f, 0.375f}](
-               const render::scene::Node* /*node*/, const render::scene::Mesh& /*mesh*/, gl::Uniform& uniform)
-             {
-               uniform.set(color);
-             });
+  const glm::uvec3 gridSize{countCells(verticesBBoxMin.x, verticesBBoxMax.x),
+                            countCells(verticesBBoxMin.y, verticesBBoxMax.y),
+                            countCells(verticesBBoxMin.z, verticesBBoxMax.z)};
+  const auto particleCount = gridSize.x * gridSize.y * gridSize.z;
+  if(particleCount == 0)
+    return;
 
-  auto dustNode = std::make_shared<render::scene::Node>(label + "-particles");
+  auto dustNode = std::make_shared<render::scene::Node>(node->getName() + "/dust-particles");
   dustNode->setLocalMatrix(translate(glm::mat4{1.0f}, position.toRenderSystem()));
-  dustNode->setRenderable(mesh);
+  dustNode->setRenderable(getDustMesh(particleCount, dustMaterial));
   dustNode->setVisible(true);
 
-  return dustNode;
+  dustNode->bind("u_baseColor",
+                 [color = isWaterRoom ? glm::vec3{0.146f, 0.485f, 0.216f} : glm::vec3{0.431f, 0.386f, 0.375f}](
+                   const render::scene::Node* /*node*/, const render::scene::Mesh& /*mesh*/, gl::Uniform& uniform)
+                 {
+                   uniform.set(color);
+                 });
+  dustNode->bind("u_dustGridOrigin",
+                 [origin = verticesBBoxMin](
+                   const render::scene::Node* /*node*/, const render::scene::Mesh& /*mesh*/, gl::Uniform& uniform)
+                 {
+                   uniform.set(origin);
+                 });
+  dustNode->bind("u_dustGridSize",
+                 [size = glm::vec3{gridSize}](
+                   const render::scene::Node* /*node*/, const render::scene::Mesh& /*mesh*/, gl::Uniform& uniform)
+                 {
+                   uniform.set(size);
+                 });
+  dustNode->bind("u_dustResolution",
+                 [resolution](const render::scene::Node* /*node*/, const render::scene::Mesh& /*mesh*/, gl::Uniform& uniform)
+                 {
+                   uniform.set(resolution);
+                 });
+  dustNode->bind("u_dustSeed",
+                 [seed = gsl::narrow_cast<uint32_t>(physicalId)](
+                   const render::scene::Node* /*node*/, const render::scene::Mesh& /*mesh*/, gl::Uniform& uniform)
+                 {
+                   uniform.set(seed);
+                 });
+
+  dust = dustNode;
 }
 } // namespace engine::world
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "core/boundingbox.h"
 #include "core/magic.h"
 #include "core/units.h"
 #include "core/vec.h"
@@ -18,6 +19,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -53,7 +55,6 @@ struct Room;
 namespace engine
 {
 struct Location;
-class Presenter;
 } // namespace engine
 
 namespace engine::world
@@ -100,13 +101,18 @@ struct Room
   std::vector<Portal> portals{};
   std::vector<Sector> sectors{};
   std::vector<RoomStaticMesh> staticMeshes{};
+  //! @brief World space collision boxes of the collidable static meshes in their original order, rotation applied
+  std::vector<core::BoundingBox> staticMeshColliders{};
+  //! @brief Per-sector ranges into staticMeshColliderCells, indexed like the sectors
+  std::vector<uint32_t> staticMeshColliderCellStarts{};
+  //! @brief Indices into staticMeshColliders of the colliders overlapping each sector
+  std::vector<uint32_t> staticMeshColliderCells{};
 
   Room* alternateRoom{nullptr};
 
   std::shared_ptr<render::scene::Node> node = nullptr;
   std::vector<gslu::nn_shared<render::scene::Node>> sceneryNodes{};
 
-  std::map<uint8_t, std::shared_ptr<render::scene::Node>> dustCache{};
   glm::vec3 verticesBBoxMin{std::numeric_limits<float>::max()};
   glm::vec3 verticesBBoxMax{std::numeric_limits<float>::lowest()};
   std::shared_ptr<render::scene::Node> dust = nullptr;
@@ -114,7 +120,7 @@ struct Room
   void createSceneNode(const loader::file::Room& srcRoom,
                        size_t roomId,
                        World&,
-                       render::TextureAnimator& animator,
+                       const render::TextureAnimator& animator,
                        render::scene::MaterialManager& materialManager);
 
   [[nodiscard]] const Sector* getSectorByAbsolutePosition(const core::TRVec& worldPos) const
@@ -158,24 +164,23 @@ struct Room
 
   void resetScenery();
 
+  void initStaticMeshColliders();
+  //! @brief Collects the indices of all static mesh colliders whose sectors overlap @p box, in ascending order
+  void collectStaticMeshColliders(const core::BoundingBox& box, std::vector<uint32_t>& indices) const;
+
   void serialize(const serialization::Serializer<World>& ser);
 
   std::vector<engine::ShaderLight> bufferLights{};
   gslu::nn_shared<gl::ShaderStorageBuffer<engine::ShaderLight>> lightsBuffer{
     std::make_shared<gl::ShaderStorageBuffer<engine::ShaderLight>>("lights-buffer")};
 
+  //! @brief The rooms within @p depth portal steps whose lights are used for shading this room, including itself
+  [[nodiscard]] std::set<gsl::not_null<const Room*>> getLightCollectionRooms(size_t depth) const;
   void collectShaderLights(size_t depth);
-  void regenerateDust(const std::shared_ptr<engine::Presenter>& presenter,
-                      const gslu::nn_shared<render::scene::Material>& dustMaterial,
+  void collectShaderLights(const std::set<gsl::not_null<const Room*>>& lightRooms);
+  void regenerateDust(const gslu::nn_shared<render::scene::Material>& dustMaterial,
                       bool isDustEnabled,
                       uint8_t dustResolutionDivisor);
-
-private:
-  std::shared_ptr<render::scene::Node> createParticleMesh(const std::string& label,
-                                                          const glm::vec3& min,
-                                                          const glm::vec3& max,
-                                                          const gslu::nn_shared<render::scene::Material>& dustMaterial,
-                                                          uint8_t dustDensity);
 };
 
 extern void patchHeightsForBlock(const engine::objects::Object& object, const core::Length& height);
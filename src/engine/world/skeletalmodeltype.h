@@ -2,11 +2,14 @@
 
 #include "core/containeroffset.h"
 #include "core/id.h"
+#include "engine/posecache.h"
+#include "engine/skinnedmeshcache.h"
 #include "loader/file/animation.h"
 #include "rendermeshdata.h"
 
 #include <gsl/gsl-lite.hpp>
 #include <gslu.h>
+#include <memory>
 
 namespace engine::world
 {
@@ -43,5 +46,8 @@ struct SkeletalModelType
 
   const loader::file::AnimFrame* frames = nullptr;
   const Animation* animations = nullptr;
+
+  std::unique_ptr<PoseCache> poseCache = std::make_unique<PoseCache>();
+  std::unique_ptr<SkinnedMeshCache> skinnedMeshCache = std::make_unique<SkinnedMeshCache>();
 };
 } // namespace engine::world
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "core/id.h"
+#include "render/scene/sprite.h"
 
+#include <cstdint>
 #include <glm/glm.hpp>
 #include <gsl/gsl-lite.hpp>
 
@@ -24,6 +26,17 @@ struct Sprite
 
   std::shared_ptr<render::scene::Mesh> yBoundMesh;
   std::shared_ptr<render::scene::Mesh> billboardMesh;
+
+  [[nodiscard]] render::scene::SpriteFrame toSpriteFrame() const
+  {
+    return {static_cast<float>(render0.x),
+            static_cast<float>(-render0.y),
+            static_cast<float>(render1.x),
+            static_cast<float>(-render1.y),
+            uv0,
+            uv1,
+            textureId.get_as<int32_t>()};
+  }
 };
 
 struct SpriteSequence
@@ -3,18 +3,18 @@
 #include "core/boundingbox.h"
 #include "core/id.h"
 
-namespace render::scene
-{
-class Mesh;
-}
+#include <memory>
 
 namespace engine::world
 {
+class RenderMeshData;
+
 struct StaticMesh
 {
   const core::BoundingBox collisionBox;
   const bool doNotCollide;
 
-  std::shared_ptr<render::scene::Mesh> renderMesh{nullptr};
+  //! @brief Untransformed geometry, baked into the static mesh batches of the rooms; @c nullptr if invisible
+  std::shared_ptr<RenderMeshData> renderMeshData{nullptr};
 };
 } // namespace engine::world
@@ -30,12 +30,12 @@
 #include "engine/objects/objectstate.h"
 #include "engine/objects/pickupobject.h"
 #include "engine/objects/tallblock.h" // IWYU pragma: keep
-#include "engine/particle.h"
 #include "engine/player.h"
 #include "engine/presenter.h"
 #include "engine/script/scriptengine.h"
 #include "engine/skeletalmodelnode.h"
 #include "engine/soundeffects_tr1.h"
+#include "engine/spriteparticles.h"
 #include "engine/tracks_tr1.h"
 #include "gsl/gsl-lite.hpp"
 #include "loader/file/animation.h"
@@ -227,17 +227,21 @@ bool evaluateCondition(floordata::SequenceCondition condition,
 void World::swapAllRooms()
 {
   BOOST_LOG_TRIVIAL(info) << "Swapping rooms";
+  std::set<gsl::not_null<const Room*>> swappedRooms;
   for(auto& room : m_rooms)
   {
     if(room.alternateRoom == nullptr)
       continue;
 
+    swappedRooms.emplace(&room);
+    swappedRooms.emplace(room.alternateRoom);
     swapWithAlternate(room, *room.alternateRoom);
   }
 
   m_roomsAreSwapped = !m_roomsAreSwapped;
-  connectSectors();
+  connectSwappedRooms(swappedRooms);
   updateStaticSoundEffects();
+  m_objectManager.invalidateLineOfSightCache();
 }
 
 bool World::isValid(const loader::file::AnimFrame* frame) const
@@ -282,6 +286,18 @@ const std::vector<Box>& World::getBoxes() const
   return m_boxes;
 }
 
+const BoxRegionGraph&
+  World::getBoxRegionGraph(const bool isFlying, const core::Length& step, const core::Length& drop) const
+{
+  auto& graph = m_boxRegionGraphs[{m_roomsAreSwapped, isFlying, step, drop}];
+  if(graph == nullptr)
+  {
+    graph = std::make_unique<BoxRegionGraph>(
+      m_boxes, BoxZones::getZoneRef(m_roomsAreSwapped, isFlying, step), step, drop);
+  }
+  return *graph;
+}
+
 void World::useAlternativeLaraAppearance(const bool withHead)
 {
   const auto& base = *findAnimatedModelForType(TR1ItemId::Lara);
@@ -339,9 +355,7 @@ void World::laraBubblesEffect(objects::Object& object)
 
   while(bubbleCount-- > 0)
   {
-    auto particle = gsl::make_shared<BubbleParticle>(Location{object.m_state.location.room, position}, *this);
-    setParent(particle, object.m_state.location.room->node);
-    m_objectManager.registerParticle(particle);
+    m_objectManager.getSpriteParticles().bubble.emit(Location{object.m_state.location.room, position});
   }
 }
 
@@ -649,7 +663,7 @@ void World::update(const bool godMode)
   m_uvAnimTime += 1_frame;
   if(m_uvAnimTime >= UVAnimTime)
   {
-    m_textureAnimator->updateCoordinates(m_atlasTiles);
+    m_textureAnimator->advance();
     m_uvAnimTime -= UVAnimTime;
   }
 
@@ -736,6 +750,22 @@ const std::unique_ptr<SkeletalModelType>& World::findAnimatedModelForType(const
   return none;
 }
 
+const std::vector<gslu::nn_shared<render::scene::Mesh>>&
+  World::getParticleMeshes(const gsl::not_null<const SkeletalModelType*>& model)
+{
+  if(const auto it = m_particleMeshes.find(model); it != m_particleMeshes.end())
+    return it->second;
+
+  std::vector<gslu::nn_shared<render::scene::Mesh>> meshes;
+  for(const auto& bone : model->bones)
+  {
+    RenderMeshDataCompositor compositor;
+    compositor.append(*bone.mesh, gl::SRGBA8{0, 0, 0, 0});
+    meshes.emplace_back(compositor.toMesh(*getPresenter().getMaterialManager(), false, false, {}));
+  }
+  return m_particleMeshes.emplace(model, std::move(meshes)).first->second;
+}
+
 gslu::nn_shared<RenderMeshData> World::getRenderMesh(const size_t idx) const
 {
   return m_meshes.at(idx).meshData;
@@ -958,6 +988,7 @@ void World::serialize(const serialization::Serializer<World>& ser)
       room.resetScenery();
       setParent(gsl::not_null{room.node}, getPresenter().getRenderer().getRootNode());
     }
+    m_objectManager.getSpriteParticles().attachTo(getPresenter().getRenderer().getRootNode());
 
     ser(S_NV("roomPhysicalIds", serialization::FrozenVector{physicalIds}));
     for(size_t i = 0; i < m_rooms.size(); ++i)
@@ -1172,6 +1203,7 @@ World::World(Engine& engine,
                                 {
                                   getPresenter().drawLoadingScreen(s);
                                 });
+  m_textureAnimator->uploadTiles(m_atlasTiles);
 
   auto sampler = gsl::make_unique<gl::Sampler>("all-textures-sampler")
                  | set(gl::api::TextureMinFilter::NearestMipmapLinear) | set(gl::api::TextureMagFilter::Nearest)
@@ -1346,6 +1378,8 @@ void World::initFromLevel(loader::file::level::Level& level, bool fromSave)
 
   connectSectors();
 
+  m_objectManager.initSpriteParticles(*this);
+  m_objectManager.getSpriteParticles().attachTo(getPresenter().getRenderer().getRootNode());
   if(!fromSave)
   {
     m_objectManager.createObjects(*this, level.m_items);
@@ -1476,6 +1510,7 @@ void World::initRooms(const loader::file::level::Level& level)
         BOOST_LOG_TRIVIAL(warning) << "No static mesh found for id " << rsm.meshId.get();
       }
     }
+    m_rooms[i].initStaticMeshColliders();
     m_rooms[i].alternateRoom = srcRoom.alternateRoom.get() >= 0 ? &m_rooms.at(srcRoom.alternateRoom.get()) : nullptr;
 
     m_rooms[i].createSceneNode(level.m_rooms.at(i), i, *this, *m_textureAnimator, *getPresenter().getMaterialManager());
@@ -1488,13 +1523,12 @@ void World::initStaticMeshes(const loader::file::level::Level& level,
 {
   for(const auto& staticMesh : level.m_staticMeshes)
   {
-    RenderMeshDataCompositor compositor;
+    std::shared_ptr<RenderMeshData> meshData;
     if(staticMesh.isVisible())
-      compositor.append(*meshesDirect.at(staticMesh.mesh)->meshData, gl::SRGBA8{0, 0, 0, 0});
-    auto mesh = compositor.toMesh(*getPresenter().getMaterialManager(), false, false, {});
-    mesh->getRenderState().setScissorTest(false);
+      meshData = meshesDirect.at(staticMesh.mesh)->meshData;
     const bool distinct
-      = m_staticMeshes.emplace(staticMesh.id, StaticMesh{staticMesh.collision_box, staticMesh.doNotCollide(), mesh})
+      = m_staticMeshes
+          .emplace(staticMesh.id, StaticMesh{staticMesh.collision_box, staticMesh.doNotCollide(), std::move(meshData)})
           .second;
 
     Expects(distinct);
@@ -1503,55 +1537,63 @@ void World::initStaticMeshes(const loader::file::level::Level& level,
 
 void World::initBoxes(const loader::file::level::Level& level)
 {
+  Expects(level.m_baseZones.flyZone.size() == level.m_boxes.size());
+  Expects(level.m_baseZones.groundZone1.size() == level.m_boxes.size());
+  Expects(level.m_baseZones.groundZone2.size() == level.m_boxes.size());
+  Expects(level.m_alternateZones.flyZone.size() == level.m_boxes.size());
+  Expects(level.m_alternateZones.groundZone1.size() == level.m_boxes.size());
+  Expects(level.m_alternateZones.groundZone2.size() == level.m_boxes.size());
+
   m_boxes.resize(level.m_boxes.size());
-  auto getOverlaps = [this, &level](const uint16_t idx) -> std::vector<gsl::not_null<Box*>>
+  for(size_t i = 0; i < m_boxes.size(); ++i)
   {
-    if(idx >= level.m_overlaps.size())
-      return {};
-
-    std::vector<gsl::not_null<Box*>> result;
-    const auto first = &level.m_overlaps.at(idx);
-    auto current = first;
-    const auto endOfUniverse = &level.m_overlaps.back() + 1;
-
-    while(current < endOfUniverse && (*current & 0x8000u) == 0)
+    const auto& src = level.m_boxes[i];
+    auto& box = m_boxes[i];
+    box.index = gsl::narrow<uint32_t>(i);
+    box.xInterval = {src.xmin, src.xmax};
+    box.zInterval = {src.zmin, src.zmax};
+    box.floor = src.floor;
+    box.blocked = src.blocked;
+    box.blockable = src.blockable;
+    box.zones.fly = level.m_baseZones.flyZone[i];
+    box.zones.ground1 = level.m_baseZones.groundZone1[i];
+    box.zones.ground2 = level.m_baseZones.groundZone2[i];
+    box.zones.flySwapped = level.m_alternateZones.flyZone[i];
+    box.zones.ground1Swapped = level.m_alternateZones.groundZone1[i];
+    box.zones.ground2Swapped = level.m_alternateZones.groundZone2[i];
+  }
+
+  // build the adjacency list in CSR layout; the ranges are collected first, because the spans may only be taken
+  // after the list is fully populated
+  std::vector<std::pair<size_t, size_t>> ranges;
+  ranges.reserve(m_boxes.size());
+  m_boxOverlaps.clear();
+  for(const auto& src : level.m_boxes)
+  {
+    const auto first = m_boxOverlaps.size();
+    if(src.overlap_index < level.m_overlaps.size())
     {
-      result.emplace_back(&m_boxes.at(*current));
-      ++current;
-    }
-    result.emplace_back(&m_boxes.at(*current & 0x7FFFu));
+      auto appendOverlap = [this](const uint16_t boxIndex)
+      {
+        const auto& other = m_boxes.at(boxIndex);
+        m_boxOverlaps.emplace_back(BoxOverlap{boxIndex, other.floor, other.zones});
+      };
 
-    return result;
-  };
+      auto current = level.m_overlaps.begin() + src.overlap_index;
+      while(current != level.m_overlaps.end() && (*current & 0x8000u) == 0)
+      {
+        appendOverlap(*current);
+        ++current;
+      }
+      if(current != level.m_overlaps.end())
+        appendOverlap(gsl::narrow_cast<uint16_t>(*current & 0x7FFFu));
+    }
+    ranges.emplace_back(first, m_boxOverlaps.size() - first);
+  }
 
-  std::transform(level.m_boxes.begin(),
-                 level.m_boxes.end(),
-                 m_boxes.begin(),
-                 [&getOverlaps](const loader::file::Box& box)
-                 {
-                   return Box{{box.xmin, box.xmax},
-                              {box.zmin, box.zmax},
-                              box.floor,
-                              box.blocked,
-                              box.blockable,
-                              getOverlaps(box.overlap_index)};
-                 });
-  Ensures(m_boxes.size() == level.m_boxes.size());
-
-  Expects(level.m_baseZones.flyZone.size() == m_boxes.size());
-  Expects(level.m_baseZones.groundZone1.size() == m_boxes.size());
-  Expects(level.m_baseZones.groundZone2.size() == m_boxes.size());
-  Expects(level.m_alternateZones.flyZone.size() == m_boxes.size());
-  Expects(level.m_alternateZones.groundZone1.size() == m_boxes.size());
-  Expects(level.m_alternateZones.groundZone2.size() == m_boxes.size());
   for(size_t i = 0; i < m_boxes.size(); ++i)
   {
-    m_boxes[i].zoneFly = level.m_baseZones.flyZone[i];
-    m_boxes[i].zoneGround1 = level.m_baseZones.groundZone1[i];
-    m_boxes[i].zoneGround2 = level.m_baseZones.groundZone2[i];
-    m_boxes[i].zoneFlySwapped = level.m_alternateZones.flyZone[i];
-    m_boxes[i].zoneGround1Swapped = level.m_alternateZones.groundZone1[i];
-    m_boxes[i].zoneGround2Swapped = level.m_alternateZones.groundZone2[i];
+    m_boxes[i].overlaps = gsl::span<const BoxOverlap>{m_boxOverlaps.data() + ranges[i].first, ranges[i].second};
   }
 }
 
@@ -1709,6 +1751,26 @@ void World::connectSectors()
   }
 }
 
+void World::connectSwappedRooms(const std::set<gsl::not_null<const Room*>>& swappedRooms)
+{
+  // sectors and portals refer to rooms by their slot in m_rooms, which is not changed by swapping the slot
+  // contents, so only the shader lights of rooms that collect lights through a swapped slot are outdated.
+  const auto depth = m_engine.getEngineConfig()->renderSettings.getLightCollectionDepth();
+  for(auto& room : m_rooms)
+  {
+    const auto lightRooms = room.getLightCollectionRooms(depth);
+    if(std::any_of(lightRooms.begin(),
+                   lightRooms.end(),
+                   [&swappedRooms](const gsl::not_null<const Room*>& lightRoom)
+                   {
+                     return swappedRooms.count(lightRoom) != 0;
+                   }))
+    {
+      room.collectShaderLights(lightRooms);
+    }
+  }
+}
+
 void World::initTextureDependentDataFromLevel(const loader::file::level::Level& level)
 {
   std::transform(level.m_textureTiles.begin(),
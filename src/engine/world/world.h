@@ -4,6 +4,7 @@
 #include "atlastile.h"
 #include "audio/emitter.h"
 #include "box.h"
+#include "boxregiongraph.h"
 #include "camerasink.h"
 #include "cinematicframe.h"
 #include "core/id.h"
@@ -37,7 +38,9 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -74,6 +77,11 @@ namespace render
 class TextureAnimator;
 } // namespace render
 
+namespace render::scene
+{
+class Mesh;
+} // namespace render::scene
+
 namespace engine::objects
 {
 class ModelObject;
@@ -199,6 +207,9 @@ public:
   bool isValid(const loader::file::AnimFrame* frame) const;
   void swapWithAlternate(Room& orig, Room& alternate);
   [[nodiscard]] const std::vector<Box>& getBoxes() const;
+  //! @brief Returns the region graph for the given movement limits and the current room swap state
+  [[nodiscard]] const BoxRegionGraph&
+    getBoxRegionGraph(bool isFlying, const core::Length& step, const core::Length& drop) const;
   [[nodiscard]] const std::vector<Room>& getRooms() const;
   std::vector<Room>& getRooms();
   [[nodiscard]] const StaticMesh* findStaticMeshById(const core::StaticMeshId& meshId) const;
@@ -228,6 +239,9 @@ public:
   void useAlternativeLaraAppearance(bool withHead = false);
   void runEffect(size_t id, objects::Object* object);
   [[nodiscard]] const std::unique_ptr<SkeletalModelType>& findAnimatedModelForType(const core::TypeId& type) const;
+  //! @brief Per-bone meshes of a model used as a particle, built on first use and shared by all its particles
+  [[nodiscard]] const std::vector<gslu::nn_shared<render::scene::Mesh>>&
+    getParticleMeshes(const gsl::not_null<const SkeletalModelType*>& model);
   [[nodiscard]] const std::vector<Animation>& getAnimations() const;
   [[nodiscard]] const std::vector<int16_t>& getPoseFrames() const;
   [[nodiscard]] gslu::nn_shared<RenderMeshData> getRenderMesh(size_t idx) const;
@@ -435,9 +449,13 @@ private:
   std::vector<Transitions> m_transitions;
   std::vector<TransitionCase> m_transitionCases;
   std::vector<Box> m_boxes;
+  std::vector<BoxOverlap> m_boxOverlaps;
+  mutable std::map<std::tuple<bool, bool, core::Length, core::Length>, std::unique_ptr<BoxRegionGraph>>
+    m_boxRegionGraphs;
   std::unordered_map<core::StaticMeshId, StaticMesh> m_staticMeshes;
   std::vector<Mesh> m_meshes;
   std::map<core::TypeId, std::unique_ptr<SkeletalModelType>> m_animatedModels;
+  std::map<const SkeletalModelType*, std::vector<gslu::nn_shared<render::scene::Mesh>>> m_particleMeshes;
   std::vector<Sprite> m_sprites;
   std::map<core::TypeId, std::unique_ptr<SpriteSequence>> m_spriteSequences;
   std::vector<AtlasTile> m_atlasTiles;
@@ -457,6 +475,8 @@ private:
   void initTextureDependentDataFromLevel(const loader::file::level::Level& level);
   void initFromLevel(loader::file::level::Level& level, bool fromSave);
   void connectSectors();
+  //! @brief Updates the room links after the contents of @p swappedRooms were swapped with their alternates
+  void connectSwappedRooms(const std::set<gsl::not_null<const Room*>>& swappedRooms);
   void updateStaticSoundEffects();
 
   void initAnimationData(const loader::file::level::Level& level);
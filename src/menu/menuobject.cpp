@@ -146,8 +146,9 @@ void MenuObject::initModel(const engine::world::World& world,
              });
   core::AnimStateId animState{0_as};
   engine::SkeletalModelNode::buildMesh(node, animState);
-  node->getRenderable()->getRenderState().setCullFace(true);
-  node->getRenderable()->getRenderState().setFrontFace(gl::api::FrontFaceDirection::Cw);
+  // the renderable may be shared with other nodes of the same model, so the state is applied through the node
+  node->getRenderState().setCullFace(true);
+  node->getRenderState().setFrontFace(gl::api::FrontFaceDirection::Cw);
 }
 
 void MenuObject::draw(const engine::world::World& world,
@@ -185,7 +186,9 @@ void MenuObject::draw(const engine::world::World& world,
     node->updatePose();
 
     render::scene::RenderContext context{render::scene::RenderMode::Full, std::nullopt};
+    context.pushState(node->getRenderState());
     node->getRenderable()->render(node.get(), context);
+    context.popState();
   }
   else
   {
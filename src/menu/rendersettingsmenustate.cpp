@@ -287,16 +287,30 @@ RenderSettingsMenuState::RenderSettingsMenuState(const std::shared_ptr<MenuRingT
     {
       toggle(engine, engine.getEngineConfig()->renderSettings.waterDenoise);
     });
-  listBox->addSetting(
-    /* translators: TR charmap encoding */ _("HBAO"),
-    [&engine]()
-    {
-      return engine.getEngineConfig()->renderSettings.hbao;
-    },
-    [&engine]()
-    {
-      toggle(engine, engine.getEngineConfig()->renderSettings.hbao);
-    });
+  {
+    auto tmp = std::make_shared<ui::widgets::ValueSelector<uint8_t>>(
+      [](uint8_t value)
+      {
+        return /* translators: TR charmap encoding */ _("HBAO \x1f\x6c 1/%1% \x1f\x6d", static_cast<uint32_t>(value));
+      },
+      [&engine](uint8_t value)
+      {
+        engine.getEngineConfig()->renderSettings.hbaoResolutionDivisor = value;
+        engine.applySettings();
+      },
+      std::vector<uint8_t>{2, 3, 4});
+    listBox->addSetting(
+      gslu::nn_shared<ui::widgets::Widget>{tmp},
+      [&engine]()
+      {
+        return engine.getEngineConfig()->renderSettings.hbao;
+      },
+      [&engine]()
+      {
+        toggle(engine, engine.getEngineConfig()->renderSettings.hbao);
+      });
+    tmp->selectValue(engine.getEngineConfig()->renderSettings.hbaoResolutionDivisor);
+  }
 
   {
     auto tmp = std::make_shared<ui::widgets::ValueSelector<uint8_t>>(
@@ -378,6 +392,17 @@ RenderSettingsMenuState::RenderSettingsMenuState(const std::shared_ptr<MenuRingT
     tmp->selectValue(engine.getEngineConfig()->renderSettings.renderResolutionDivisor);
   }
 
+  listBox->addSetting(
+    /* translators: TR charmap encoding */ _("Dynamic Resolution"),
+    [&engine]()
+    {
+      return engine.getEngineConfig()->renderSettings.dynamicResolution;
+    },
+    [&engine]()
+    {
+      toggle(engine, engine.getEngineConfig()->renderSettings.dynamicResolution);
+    });
+
   {
     auto tmp = std::make_shared<ui::widgets::ValueSelector<uint8_t>>(
       [](uint8_t value)
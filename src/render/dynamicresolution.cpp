@@ -0,0 +1,75 @@
+#include "dynamicresolution.h"
+
+#include <algorithm>
+#include <cmath>
+#include <gsl/gsl-lite.hpp>
+
+namespace render
+{
+namespace
+{
+//! @brief Weight of a new sample in the moving frame time average.
+constexpr float AverageWeight = 0.1f;
+//! @brief Minimum number of samples between two scale changes.
+constexpr size_t CoolDownSamples = 30;
+//! @brief The scale is only increased if the frame is expected to stay this far below the target time.
+constexpr float IncreaseHeadroom = 0.85f;
+
+float quantise(float scale)
+{
+  return std::floor(scale / DynamicResolution::ScaleStep) * DynamicResolution::ScaleStep;
+}
+} // namespace
+
+DynamicResolution::DynamicResolution(float minScale, float maxScale, float targetFrameTimeMs)
+    : m_minScale{minScale}
+    , m_maxScale{maxScale}
+    , m_targetFrameTimeMs{targetFrameTimeMs}
+    , m_scale{maxScale}
+{
+  Expects(targetFrameTimeMs > 0);
+  setBounds(minScale, maxScale);
+}
+
+void DynamicResolution::setBounds(float minScale, float maxScale)
+{
+  Expects(minScale > 0 && minScale <= maxScale);
+  m_minScale = quantise(minScale);
+  m_maxScale = quantise(maxScale);
+  m_scale = std::clamp(m_scale, m_minScale, m_maxScale);
+}
+
+void DynamicResolution::addFrameTime(float frameTimeMs)
+{
+  if(m_samples == 0)
+    m_averageFrameTimeMs = frameTimeMs;
+  else
+    m_averageFrameTimeMs += (frameTimeMs - m_averageFrameTimeMs) * AverageWeight;
+  ++m_samples;
+
+  if(m_samples < CoolDownSamples)
+    return;
+
+  // the frame cost is roughly proportional to the pixel count, i.e. the square of the scale
+  float newScale = m_scale;
+  if(m_averageFrameTimeMs > m_targetFrameTimeMs)
+  {
+    newScale = quantise(m_scale * std::sqrt(m_targetFrameTimeMs / m_averageFrameTimeMs));
+  }
+  else
+  {
+    const auto nextScale = m_scale + ScaleStep;
+    const auto expectedFrameTimeMs = m_averageFrameTimeMs * (nextScale * nextScale) / (m_scale * m_scale);
+    if(expectedFrameTimeMs < m_targetFrameTimeMs * IncreaseHeadroom)
+      newScale = nextScale;
+  }
+
+  newScale = std::clamp(newScale, m_minScale, m_maxScale);
+  if(newScale == m_scale)
+    return;
+
+  // samples still in flight were taken at the old scale, so start over
+  m_scale = newScale;
+  m_samples = 0;
+}
+} // namespace render
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+
+namespace render
+{
+//! @brief Picks the render scale from the measured GPU time of previous frames.
+//! @details The scale is quantised and only changes after a cool-down period, so that it does not oscillate between
+//!          frames.
+class DynamicResolution final
+{
+public:
+  static constexpr float ScaleStep = 1.0f / 16;
+
+  explicit DynamicResolution(float minScale, float maxScale, float targetFrameTimeMs);
+
+  void setBounds(float minScale, float maxScale);
+
+  //! @brief Adds the measured GPU time of a frame and adapts the scale.
+  void addFrameTime(float frameTimeMs);
+
+  [[nodiscard]] float getScale() const noexcept
+  {
+    return m_scale;
+  }
+
+  //! @brief The largest scale that may be used, i.e. the scale the render targets must be allocated for.
+  [[nodiscard]] float getMaxScale() const noexcept
+  {
+    return m_maxScale;
+  }
+
+private:
+  float m_minScale;
+  float m_maxScale;
+  const float m_targetFrameTimeMs;
+  float m_scale;
+  float m_averageFrameTimeMs = 0;
+  size_t m_samples = 0;
+};
+} // namespace render
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <glm/vec2.hpp>
+#include <gsl/gsl-lite.hpp>
+#include <gslu.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <typeindex>
+#include <vector>
+
+namespace render::pass
+{
+//! @brief Hands out render targets, re-using those which are not referenced by any pass anymore.
+//! @details When passes are rebuilt, the targets of the old passes can be re-used by the new ones instead of
+//!          re-allocating the storage.
+//! @tparam TTexture The common base class of all targets.
+//! @tparam TTarget The target type for a pixel type, constructible from its size and label.
+template<typename TTexture, template<typename> typename TTarget>
+class BasicRenderTargetPool final
+{
+public:
+  template<typename TPixel>
+  [[nodiscard]] gslu::nn_shared<TTarget<TPixel>> acquire(const glm::ivec2& size, const std::string& label)
+  {
+    using Target = TTarget<TPixel>;
+
+    auto& targets = m_targets[{std::type_index{typeid(Target)}, size.x, size.y}];
+    for(const auto& target : targets)
+    {
+      if(target.use_count() == 1)
+        return gsl::not_null{std::static_pointer_cast<Target>(target)};
+    }
+
+    auto target = gsl::make_shared<Target>(size, label);
+    targets.emplace_back(target.get());
+    return target;
+  }
+
+  //! @brief Releases all targets not referenced outside of the pool.
+  void collect()
+  {
+    for(auto it = m_targets.begin(); it != m_targets.end();)
+    {
+      auto& targets = it->second;
+      targets.erase(std::remove_if(targets.begin(),
+                                   targets.end(),
+                                   [](const std::shared_ptr<TTexture>& target)
+                                   {
+                                     return target.use_count() == 1;
+                                   }),
+                    targets.end());
+      if(targets.empty())
+        it = m_targets.erase(it);
+      else
+        ++it;
+    }
+  }
+
+  //! @brief The number of targets held by the pool, whether they are in use or not.
+  [[nodiscard]] size_t size() const
+  {
+    size_t result = 0;
+    for(const auto& [key, targets] : m_targets)
+      result += targets.size();
+    return result;
+  }
+
+private:
+  //! @brief The target type is part of the key, so the targets can be safely cast back.
+  std::map<std::tuple<std::type_index, int, int>, std::vector<std::shared_ptr<TTexture>>> m_targets;
+};
+} // namespace render::pass
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "config.h"
+#include "render/renderregion.h"
 #include "render/scene/mesh.h"
 #include "render/scene/rendercontext.h"
+#include "rendertargetpool.h"
 
 #include <gl/debuggroup.h>
 #include <gl/framebuffer.h>
@@ -32,12 +34,13 @@ class EffectPass final
 {
 public:
   explicit EffectPass(gsl::not_null<const RenderPipeline*> renderPipeline,
+                      RenderTargetPool& renderTargetPool,
                       std::string name,
                       const gslu::nn_shared<scene::Material>& material,
                       const gslu::nn_shared<gl::TextureHandle<gl::Texture2D<TPixel>>>& input)
       : m_name{std::move(name)}
       , m_mesh{scene::createScreenQuad(material, m_name)}
-      , m_output{std::make_shared<gl::Texture2D<TPixel>>(input->getTexture()->size(), m_name + "-color")}
+      , m_output{renderTargetPool.acquire<TPixel>(input->getTexture()->size(), m_name + "-color")}
       , m_outputHandle{std::make_shared<gl::TextureHandle<gl::Texture2D<TPixel>>>(
           m_output,
           gsl::make_unique<gl::Sampler>(m_name + "-color-sampler")
@@ -64,10 +67,11 @@ public:
     m_mesh->getRenderState().merge(m_fb->getRenderState());
   }
 
-  void render(bool inWater)
+  void render(bool inWater, const RenderRegion& region)
   {
     SOGLB_DEBUGGROUP(m_name + "-pass");
 
+    setRenderRegion(*m_mesh, region, m_output->size());
     m_fb->bind();
 
     scene::RenderContext context{scene::RenderMode::Full, std::nullopt};
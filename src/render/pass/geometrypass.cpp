@@ -1,5 +1,7 @@
 #include "geometrypass.h"
 
+#include "render/renderregion.h"
+
 #include <algorithm>
 #include <gl/framebuffer.h>
 #include <gl/pixel.h>
@@ -55,11 +57,12 @@ GeometryPass::GeometryPass(const glm::ivec2& viewport)
 GeometryPass::~GeometryPass() = default;
 
 // NOLINTNEXTLINE(readability-make-member-function-const)
-void GeometryPass::bind()
+void GeometryPass::bind(const RenderRegion& region)
 {
   m_fb->bind();
   gl::RenderState::resetWantedState();
   gl::RenderState::getWantedState().merge(m_fb->getRenderState());
+  gl::RenderState::getWantedState().setViewport(region.getViewport(m_depthBuffer->size()));
   gl::RenderState::applyWantedState();
 }
 } // namespace render::pass
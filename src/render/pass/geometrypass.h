@@ -7,6 +7,11 @@
 #include <gslu.h>
 #include <memory>
 
+namespace render
+{
+class RenderRegion;
+}
+
 namespace render::pass
 {
 class GeometryPass
@@ -14,7 +19,7 @@ class GeometryPass
 public:
   explicit GeometryPass(const glm::ivec2& viewport);
   ~GeometryPass();
-  void bind();
+  void bind(const RenderRegion& region);
 
   [[nodiscard]] const auto& getNormalBuffer() const
   {
@@ -2,6 +2,7 @@
 
 #include "config.h"
 #include "geometrypass.h"
+#include "render/scene/camera.h"
 #include "render/scene/material.h"
 #include "render/scene/materialmanager.h"
 #include "render/scene/mesh.h"
@@ -19,10 +20,14 @@
 #include <gl/sampler.h>
 #include <gl/texture2d.h>
 #include <gl/texturehandle.h>
+#include <glm/geometric.hpp>
 #include <glm/mat4x4.hpp>
+#include <glm/matrix.hpp>
+#include <glm/vec3.hpp>
 #include <gsl/gsl-lite.hpp>
 #include <gslu.h>
 #include <optional>
+#include <string>
 
 namespace render::scene
 {
@@ -31,6 +36,30 @@ class Node;
 
 namespace render::pass
 {
+namespace
+{
+//! @brief Weight of the reprojected occlusion of previous frames.
+constexpr float HistoryWeight = 0.8f;
+
+//! @brief Camera movements between two rendered frames exceeding these limits are considered a cut, which
+//!        invalidates the history.
+//! @{
+constexpr float MaxHistoryTranslation = 1024.0f;
+//! @brief Cosine of 30 degrees
+constexpr float MinHistoryRotationCos = 0.866f;
+//! @}
+
+[[nodiscard]] bool isCameraCut(const glm::mat4& reprojection)
+{
+  if(glm::length(glm::vec3{reprojection[3]}) > MaxHistoryTranslation)
+    return true;
+
+  // the rotation angle of the reprojection is derived from the trace of its rotation part
+  const auto rotationCos = (reprojection[0][0] + reprojection[1][1] + reprojection[2][2] - 1.0f) / 2.0f;
+  return rotationCos < MinHistoryRotationCos;
+}
+} // namespace
+
 HBAOPass::HBAOPass(scene::MaterialManager& materialManager,
                    const glm::ivec2& viewport,
                    const GeometryPass& geometryPass)
@@ -44,9 +73,15 @@ HBAOPass::HBAOPass(scene::MaterialManager& materialManager,
           | set(gl::api::SamplerParameterI::TextureWrapT, gl::api::TextureWrapMode::ClampToEdge)
           | set(gl::api::TextureMinFilter::Linear) | set(gl::api::TextureMagFilter::Linear))}
     , m_blur{"hbao", materialManager, 2, false}
-    , m_fb{gl::FrameBufferBuilder()
-             .textureNoBlend(gl::api::FramebufferAttachment::ColorAttachment0, m_aoBuffer)
-             .build("hbao-fb")}
+    , m_history{createHistory(viewport, "hbao-history-0"), createHistory(viewport, "hbao-history-1")}
+    , m_fbs{gl::FrameBufferBuilder()
+              .textureNoBlend(gl::api::FramebufferAttachment::ColorAttachment0, m_aoBuffer)
+              .textureNoBlend(gl::api::FramebufferAttachment::ColorAttachment1, m_history[0]->getTexture())
+              .build("hbao-fb-0"),
+            gl::FrameBufferBuilder()
+              .textureNoBlend(gl::api::FramebufferAttachment::ColorAttachment0, m_aoBuffer)
+              .textureNoBlend(gl::api::FramebufferAttachment::ColorAttachment1, m_history[1]->getTexture())
+              .build("hbao-fb-1")}
 {
   m_renderMesh->bind("u_normals",
                      [buffer = geometryPass.getNormalBuffer()](
@@ -60,24 +95,92 @@ HBAOPass::HBAOPass(scene::MaterialManager& materialManager,
                      {
                        uniform.set(buffer);
                      });
-  m_renderMesh->getRenderState().merge(m_fb->getRenderState());
+  // the history written in the previous frame is read in this frame
+  m_renderMesh->bind("u_history",
+                     [this](const render::scene::Node* /*node*/,
+                            const render::scene::Mesh& /*mesh*/,
+                            gl::Uniform& uniform)
+                     {
+                       uniform.set(m_history[(m_frame + 1) % m_history.size()]);
+                     });
+  m_renderMesh->bind("u_historyWeight",
+                     [this](const render::scene::Node* /*node*/,
+                            const render::scene::Mesh& /*mesh*/,
+                            gl::Uniform& uniform)
+                     {
+                       uniform.set(m_historyValid ? HistoryWeight : 0.0f);
+                     });
+  m_renderMesh->bind("u_reprojection",
+                     [this](const render::scene::Node* /*node*/,
+                            const render::scene::Mesh& /*mesh*/,
+                            gl::Uniform& uniform)
+                     {
+                       uniform.set(m_reprojection);
+                     });
+  m_renderMesh->bind("u_frame",
+                     [this](const render::scene::Node* /*node*/,
+                            const render::scene::Mesh& /*mesh*/,
+                            gl::Uniform& uniform)
+                     {
+                       uniform.set(gsl::narrow_cast<float>(m_frame % 1024u));
+                     });
+  m_renderMesh->getRenderState().merge(m_fbs[0]->getRenderState());
 
   m_blur.setInput(gsl::not_null{m_aoBufferHandle});
 }
 
-void HBAOPass::updateCamera(const gslu::nn_shared<scene::Camera>& camera)
+gslu::nn_shared<HBAOPass::HistoryHandle> HBAOPass::createHistory(const glm::ivec2& viewport, const std::string& name)
+{
+  return gsl::make_shared<HistoryHandle>(
+    gsl::make_shared<gl::Texture2D<gl::RG16F>>(viewport, name),
+    gsl::make_unique<gl::Sampler>(name + "-sampler")
+      | set(gl::api::SamplerParameterI::TextureWrapS, gl::api::TextureWrapMode::ClampToEdge)
+      | set(gl::api::SamplerParameterI::TextureWrapT, gl::api::TextureWrapMode::ClampToEdge)
+      | set(gl::api::TextureMinFilter::Nearest) | set(gl::api::TextureMagFilter::Nearest));
+}
+
+void HBAOPass::updateCamera(const gslu::nn_shared<scene::Camera>& camera, const uint64_t frameIndex)
 {
   m_material->getUniformBlock("Camera")->bindCameraBuffer(camera);
+
+  // the history can only be reprojected from the directly preceding frame
+  if(!m_renderedFrameIndex.has_value() || *m_renderedFrameIndex + 1 != frameIndex)
+  {
+    m_historyValid = false;
+    m_prevViewMatrix.reset();
+  }
+  m_cameraFrameIndex = frameIndex;
+
+  const auto& viewMatrix = camera->getViewMatrix();
+  m_reprojection = m_prevViewMatrix.value_or(viewMatrix) * glm::inverse(viewMatrix);
+  if(isCameraCut(m_reprojection))
+  {
+    m_historyValid = false;
+    m_reprojection = glm::mat4{1.0f};
+  }
+  m_prevViewMatrix = viewMatrix;
 }
 
-void HBAOPass::render()
+void HBAOPass::render(const RenderRegion& region)
 {
   SOGLB_DEBUGGROUP("hbao-pass");
-  m_fb->bind();
+  if(region != m_historyRegion)
+  {
+    // the history covers a different part of the targets after a render scale change
+    m_historyValid = false;
+    m_historyRegion = region;
+  }
+
+  setRenderRegion(*m_renderMesh, region, m_aoBuffer->size());
+  m_fbs[m_frame % m_fbs.size()]->bind();
 
   scene::RenderContext context{scene::RenderMode::Full, std::nullopt};
   m_renderMesh->render(nullptr, context);
-  m_blur.render();
+  m_blur.render(region);
+
+  m_historyValid = true;
+  m_renderedFrameIndex = m_cameraFrameIndex;
+  ++m_frame;
 
   if constexpr(FlushPasses)
     GL_ASSERT(gl::api::finish());
@@ -1,13 +1,19 @@
 #pragma once
 
+#include "render/renderregion.h"
 #include "render/scene/blur.h"
 
+#include <array>
+#include <cstdint>
 #include <gl/pixel.h>
 #include <gl/soglb_fwd.h>
 #include <glm/fwd.hpp>
+#include <glm/mat4x4.hpp>
 #include <gsl/gsl-lite.hpp>
 #include <gslu.h>
 #include <memory>
+#include <optional>
+#include <string>
 
 namespace render::scene
 {
@@ -27,9 +33,10 @@ public:
   explicit HBAOPass(scene::MaterialManager& materialManager,
                     const glm::ivec2& viewport,
                     const GeometryPass& geometryPass);
-  void updateCamera(const gslu::nn_shared<scene::Camera>& camera);
+  //! @param frameIndex The index of the presented frame, used to detect frames in which the pass was not rendered.
+  void updateCamera(const gslu::nn_shared<scene::Camera>& camera, uint64_t frameIndex);
 
-  void render();
+  void render(const RenderRegion& region);
 
   [[nodiscard]] auto getBlurredTexture() const
   {
@@ -37,6 +44,8 @@ public:
   }
 
 private:
+  using HistoryHandle = gl::TextureHandle<gl::Texture2D<gl::RG16F>>;
+
   const gslu::nn_shared<scene::Material> m_material;
 
   gslu::nn_shared<scene::Mesh> m_renderMesh;
@@ -44,6 +53,25 @@ private:
   gslu::nn_shared<gl::Texture2D<gl::ScalarByte>> m_aoBuffer;
   gslu::nn_shared<gl::TextureHandle<gl::Texture2D<gl::ScalarByte>>> m_aoBufferHandle;
   scene::SeparableBlur<gl::ScalarByte> m_blur;
-  gslu::nn_shared<gl::Framebuffer> m_fb;
+
+  //! @brief Accumulated occlusion and depth; one is read while the other one is written, swapped every frame.
+  std::array<gslu::nn_shared<HistoryHandle>, 2> m_history;
+  std::array<gslu::nn_shared<gl::Framebuffer>, 2> m_fbs;
+  uint32_t m_frame = 0;
+  bool m_historyValid = false;
+  //! @brief The frame index of the last camera update, and of the last rendered frame; if a frame was skipped, the
+  //!        history doesn't match the previous view matrix anymore.
+  //! @{
+  uint64_t m_cameraFrameIndex = 0;
+  std::optional<uint64_t> m_renderedFrameIndex{};
+  //! @}
+  //! @brief The region the history was rendered into.
+  RenderRegion m_historyRegion{};
+
+  std::optional<glm::mat4> m_prevViewMatrix;
+  glm::mat4 m_reprojection{1.0f};
+
+  [[nodiscard]] static gslu::nn_shared<HistoryHandle> createHistory(const glm::ivec2& viewport,
+                                                                    const std::string& name);
 };
 } // namespace render::pass
@@ -1,5 +1,6 @@
 #include "portalpass.h"
 
+#include "render/renderregion.h"
 #include "render/scene/blur.h"
 
 #include <algorithm>
@@ -47,10 +48,12 @@ PortalPass::PortalPass(scene::MaterialManager& materialManager,
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const)
-gl::RenderState PortalPass::bind()
+gl::RenderState PortalPass::bind(const RenderRegion& region)
 {
   m_positionBuffer->clear(gl::Scalar32F{-std::numeric_limits<float>::infinity()});
   m_fb->bind();
-  return m_fb->getRenderState();
+  auto state = m_fb->getRenderState();
+  state.setViewport(region.getViewport(m_positionBuffer->size()));
+  return state;
 }
 } // namespace render::pass
@@ -24,11 +24,11 @@ public:
                       const gslu::nn_shared<gl::TextureDepth<float>>& depthBuffer,
                       const glm::vec2& viewport);
 
-  [[nodiscard]] gl::RenderState bind();
+  [[nodiscard]] gl::RenderState bind(const RenderRegion& region);
 
-  void renderBlur()
+  void renderBlur(const RenderRegion& region)
   {
-    m_blur.render();
+    m_blur.render(region);
   }
 
   [[nodiscard]] auto getPositionBuffer() const
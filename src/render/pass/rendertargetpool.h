@@ -0,0 +1,10 @@
+#pragma once
+
+#include "basicrendertargetpool.h"
+
+#include <gl/texture2d.h>
+
+namespace render::pass
+{
+using RenderTargetPool = BasicRenderTargetPool<gl::Texture, gl::Texture2D>;
+} // namespace render::pass
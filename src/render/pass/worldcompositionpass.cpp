@@ -4,6 +4,7 @@
 #include "geometrypass.h"
 #include "portalpass.h"
 #include "render/renderpipeline.h"
+#include "render/renderregion.h"
 #include "render/rendersettings.h"
 #include "render/scene/material.h"
 #include "render/scene/materialmanager.h"
@@ -37,6 +38,7 @@ class Node;
 namespace render::pass
 {
 WorldCompositionPass::WorldCompositionPass(gsl::not_null<const RenderPipeline*> renderPipeline,
+                                           RenderTargetPool& renderTargetPool,
                                            scene::MaterialManager& materialManager,
                                            const RenderSettings& renderSettings,
                                            const glm::ivec2& viewport,
@@ -47,14 +49,14 @@ WorldCompositionPass::WorldCompositionPass(gsl::not_null<const RenderPipeline*>
     , m_noWaterMesh{scene::createScreenQuad(m_noWaterMaterial, "composition-nowater")}
     , m_inWaterMesh{scene::createScreenQuad(m_inWaterMaterial, "composition-water")}
     , m_bloomMesh{scene::createScreenQuad(materialManager.getBloom(), "composition-bloom")}
-    , m_colorBuffer{std::make_shared<gl::Texture2D<gl::SRGB8>>(viewport, "composition-color")}
+    , m_colorBuffer{renderTargetPool.acquire<gl::SRGB8>(viewport, "composition-color")}
     , m_colorBufferHandle{std::make_shared<gl::TextureHandle<gl::Texture2D<gl::SRGB8>>>(
         m_colorBuffer,
         gsl::make_unique<gl::Sampler>("composition-color-sampler")
           | set(gl::api::SamplerParameterI::TextureWrapS, gl::api::TextureWrapMode::Repeat)
           | set(gl::api::SamplerParameterI::TextureWrapT, gl::api::TextureWrapMode::Repeat)
           | set(gl::api::TextureMinFilter::Linear) | set(gl::api::TextureMagFilter::Linear))}
-    , m_bloomedBuffer{std::make_shared<gl::Texture2D<gl::SRGB8>>(viewport, "composition-bloomed")}
+    , m_bloomedBuffer{renderTargetPool.acquire<gl::SRGB8>(viewport, "composition-bloomed")}
     , m_bloomedBufferHandle{std::make_shared<gl::TextureHandle<gl::Texture2D<gl::SRGB8>>>(
         m_bloomedBuffer,
         gsl::make_unique<gl::Sampler>("composition-bloomed-sampler")
@@ -65,7 +67,11 @@ WorldCompositionPass::WorldCompositionPass(gsl::not_null<const RenderPipeline*>
              .textureNoBlend(gl::api::FramebufferAttachment::ColorAttachment0, m_colorBuffer)
              .textureNoBlend(gl::api::FramebufferAttachment::DepthAttachment, geometryPass.getDepthBuffer())
              .build("composition-fb")}
-    , m_bloomFilter{std::move(renderPipeline), "bloomfilter", materialManager.getBloomFilter(), m_colorBufferHandle}
+    , m_bloomFilter{std::move(renderPipeline),
+                    renderTargetPool,
+                    "bloomfilter",
+                    materialManager.getBloomFilter(),
+                    m_colorBufferHandle}
     , m_fbBloom{gl::FrameBufferBuilder()
                   .textureNoBlend(gl::api::FramebufferAttachment::ColorAttachment0, m_bloomedBuffer)
                   .build("composition-fb-bloom")}
@@ -173,9 +179,11 @@ void WorldCompositionPass::updateCamera(const gslu::nn_shared<scene::Camera>& ca
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const)
-void WorldCompositionPass::render(bool inWater)
+void WorldCompositionPass::render(bool inWater, const RenderRegion& region)
 {
   SOGLB_DEBUGGROUP("world-composition-pass");
+  setRenderRegion(*m_noWaterMesh, region, m_colorBuffer->size());
+  setRenderRegion(*m_inWaterMesh, region, m_colorBuffer->size());
   m_fb->bind();
 
   scene::RenderContext context{scene::RenderMode::Full, std::nullopt};
@@ -186,9 +194,10 @@ void WorldCompositionPass::render(bool inWater)
 
   if(m_bloom)
   {
-    m_bloomFilter.render(false);
-    m_bloomBlur1.render();
-    m_bloomBlur2.render();
+    m_bloomFilter.render(false, region);
+    m_bloomBlur1.render(region);
+    m_bloomBlur2.render(region);
+    setRenderRegion(*m_bloomMesh, region, m_bloomedBuffer->size());
     m_fbBloom->bind();
     m_bloomMesh->render(nullptr, context);
   }
@@ -32,6 +32,7 @@ class WorldCompositionPass
 {
 public:
   explicit WorldCompositionPass(gsl::not_null<const RenderPipeline*> renderPipeline,
+                                RenderTargetPool& renderTargetPool,
                                 scene::MaterialManager& materialManager,
                                 const RenderSettings& renderSettings,
                                 const glm::ivec2& viewport,
@@ -40,7 +41,7 @@ public:
 
   void updateCamera(const gslu::nn_shared<scene::Camera>& camera);
 
-  void render(bool inWater);
+  void render(bool inWater, const RenderRegion& region);
 
   [[nodiscard]] const auto& getColorBuffer() const
   {
@@ -165,7 +165,8 @@ bool PortalTracer::traceRoom(const engine::world::Room& room,
                              const bool inWater,
                              std::unordered_set<const engine::world::Portal*>& waterSurfacePortals,
                              const bool startFromWater,
-                             int depth)
+                             int depth,
+                             std::vector<TraceStep>& steps)
 {
   if(std::find(seenRooms.rbegin(), seenRooms.rend(), &room) != seenRooms.rend())
     return false;
@@ -173,6 +174,7 @@ bool PortalTracer::traceRoom(const engine::world::Room& room,
 
   room.node->setVisible(true);
   room.node->setRenderOrder(-depth);
+  steps.emplace_back(TraceStep{&room, -depth, std::nullopt});
   for(const auto& portal : room.portals)
   {
     if(const auto narrowedCullBox = narrowCullBox(roomCullBox, portal, world.getCameraController()))
@@ -180,6 +182,7 @@ bool PortalTracer::traceRoom(const engine::world::Room& room,
       const auto& childRoom = portal.adjoiningRoom;
       const bool waterChanged = inWater == startFromWater && childRoom->isWaterRoom != startFromWater;
       childRoom->node->addScissor(narrowedCullBox->min, narrowedCullBox->max - narrowedCullBox->min);
+      steps.emplace_back(TraceStep{childRoom.get(), std::nullopt, *narrowedCullBox});
       if(traceRoom(*childRoom,
                    *narrowedCullBox,
                    world,
@@ -187,7 +190,8 @@ bool PortalTracer::traceRoom(const engine::world::Room& room,
                    inWater || childRoom->isWaterRoom,
                    waterSurfacePortals,
                    startFromWater,
-                   depth + 1)
+                   depth + 1,
+                   steps)
          && waterChanged)
       {
         waterSurfacePortals.emplace(&portal);
@@ -201,12 +205,45 @@ bool PortalTracer::traceRoom(const engine::world::Room& room,
 std::unordered_set<const engine::world::Portal*> PortalTracer::trace(const engine::world::Room& startRoom,
                                                                      const engine::world::World& world)
 {
+  const auto& camera = world.getCameraController();
+  CacheKey key{&world,
+               &startRoom,
+               world.roomsAreSwapped(),
+               camera.getPosition(),
+               camera.getCamera()->getViewMatrix(),
+               camera.getCamera()->getProjectionMatrix()};
+  if(m_cacheKey == key)
+  {
+    for(const auto& step : m_steps)
+    {
+      if(step.renderOrder.has_value())
+      {
+        step.room->node->setVisible(true);
+        step.room->node->setRenderOrder(*step.renderOrder);
+      }
+      if(step.scissor.has_value())
+      {
+        step.room->node->addScissor(step.scissor->min, step.scissor->max - step.scissor->min);
+      }
+    }
+    return m_waterSurfacePortals;
+  }
+
   std::vector<const engine::world::Room*> seenRooms;
   seenRooms.reserve(32);
-  std::unordered_set<const engine::world::Portal*> waterSurfacePortals;
-  traceRoom(
-    startRoom, {-1, -1, 1, 1}, world, seenRooms, startRoom.isWaterRoom, waterSurfacePortals, startRoom.isWaterRoom, 1);
+  m_steps.clear();
+  m_waterSurfacePortals.clear();
+  traceRoom(startRoom,
+            {-1, -1, 1, 1},
+            world,
+            seenRooms,
+            startRoom.isWaterRoom,
+            m_waterSurfacePortals,
+            startRoom.isWaterRoom,
+            1,
+            m_steps);
   Expects(seenRooms.empty());
-  return waterSurfacePortals;
+  m_cacheKey = key;
+  return m_waterSurfacePortals;
 }
 } // namespace render
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <glm/mat4x4.hpp>
 #include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
 #include <optional>
 #include <unordered_set>
 #include <vector>
@@ -33,8 +35,19 @@ struct PortalTracer
     }
   };
 
-  static std::unordered_set<const engine::world::Portal*> trace(const engine::world::Room& startRoom,
-                                                                const engine::world::World& world);
+  //! @brief A change of a room node's render state, recorded so that it can be replayed
+  struct TraceStep
+  {
+    const engine::world::Room* room;
+    //! @brief The render order the room became visible with, or the scissor added to it
+    std::optional<int> renderOrder;
+    std::optional<CullBox> scissor;
+  };
+
+  //! @brief Traces the visible rooms; if neither the camera nor the rooms changed since the last call, the previous
+  //!        result is replayed instead of narrowing the portals again.
+  std::unordered_set<const engine::world::Portal*> trace(const engine::world::Room& startRoom,
+                                                         const engine::world::World& world);
 
   static bool traceRoom(const engine::world::Room& room,
                         const CullBox& roomCullBox,
@@ -43,10 +56,32 @@ struct PortalTracer
                         bool inWater,
                         std::unordered_set<const engine::world::Portal*>& waterSurfacePortals,
                         bool startFromWater,
-                        int depth);
+                        int depth,
+                        std::vector<TraceStep>& steps);
 
   static std::optional<CullBox> narrowCullBox(const CullBox& parentCullBox,
                                               const engine::world::Portal& portal,
                                               const engine::CameraController& camera);
+
+private:
+  struct CacheKey
+  {
+    const engine::world::World* world;
+    const engine::world::Room* startRoom;
+    bool roomsAreSwapped;
+    glm::vec3 cameraPosition;
+    glm::mat4 view;
+    glm::mat4 projection;
+
+    bool operator==(const CacheKey& rhs) const
+    {
+      return world == rhs.world && startRoom == rhs.startRoom && roomsAreSwapped == rhs.roomsAreSwapped
+             && cameraPosition == rhs.cameraPosition && view == rhs.view && projection == rhs.projection;
+    }
+  };
+
+  std::optional<CacheKey> m_cacheKey;
+  std::vector<TraceStep> m_steps;
+  std::unordered_set<const engine::world::Portal*> m_waterSurfacePortals;
 };
 } // namespace render
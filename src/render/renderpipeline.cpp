@@ -7,19 +7,23 @@
 #include "pass/portalpass.h"
 #include "pass/uipass.h"
 #include "pass/worldcompositionpass.h"
+#include "render/scene/hizbuffer.h"
 #include "render/scene/materialmanager.h"
 #include "render/scene/visitor.h"
 #include "rendersettings.h"
 
+#include <algorithm>
 #include <boost/assert.hpp>
 #include <gl/framebuffer.h>
 #include <gl/program.h>
 #include <gl/texture2d.h>
 #include <gl/texturedepth.h>
 #include <gl/texturehandle.h>
+#include <glm/common.hpp>
 #include <glm/vec2.hpp>
 #include <gsl/gsl-lite.hpp>
 #include <string>
+#include <utility>
 
 namespace render::scene
 {
@@ -42,14 +46,14 @@ void RenderPipeline::worldCompositionPass(const std::vector<engine::world::Room>
 {
   BOOST_ASSERT(m_portalPass != nullptr);
   if(m_renderSettings.waterDenoise)
-    m_portalPass->renderBlur();
+    m_portalPass->renderBlur(m_renderRegion);
 
   BOOST_ASSERT(m_hbaoPass != nullptr);
   if(m_renderSettings.hbao)
-    m_hbaoPass->render();
+    m_hbaoPass->render(m_renderRegion);
 
   BOOST_ASSERT(m_worldCompositionPass != nullptr);
-  m_worldCompositionPass->render(inWater);
+  m_worldCompositionPass->render(inWater, m_renderRegion);
 
   {
     render::scene::RenderContext context{render::scene::RenderMode::Full, std::nullopt};
@@ -60,6 +64,7 @@ void RenderPipeline::worldCompositionPass(const std::vector<engine::world::Room>
 
       SOGLB_DEBUGGROUP(room.node->getName() + ":dust");
       auto state = context.getCurrentState();
+      state.setViewport(m_renderRegion.getViewport(m_renderSize));
       state.setScissorTest(true);
       const auto [xy, size] = room.node->getCombinedScissors();
       state.setScissorRegion(xy, size);
@@ -76,13 +81,13 @@ void RenderPipeline::worldCompositionPass(const std::vector<engine::world::Room>
   auto finalOutput = m_worldCompositionPass->getFramebuffer();
   for(const auto& effect : m_effects)
   {
-    effect->render(inWater);
+    effect->render(inWater, m_renderRegion);
     finalOutput = effect->getFramebuffer();
   }
   gsl_Assert(m_backbuffer != nullptr);
   gl::RenderState::getWantedState().setViewport(m_displaySize);
   gl::RenderState::applyWantedState();
-  finalOutput->blit(*m_backbuffer);
+  finalOutput->blit(*m_backbuffer, m_renderRegion.getViewport(m_renderSize));
 }
 
 void RenderPipeline::updateCamera(const gslu::nn_shared<scene::Camera>& camera)
@@ -90,14 +95,36 @@ void RenderPipeline::updateCamera(const gslu::nn_shared<scene::Camera>& camera)
   BOOST_ASSERT(m_worldCompositionPass != nullptr);
   m_worldCompositionPass->updateCamera(camera);
   BOOST_ASSERT(m_hbaoPass != nullptr);
-  if(m_renderSettings.hbao)
-    m_hbaoPass->updateCamera(camera);
+  // also updated when disabled, so that the skipped frames invalidate its history
+  m_hbaoPass->updateCamera(camera, m_frameIndex);
 }
 
 void RenderPipeline::apply(const RenderSettings& renderSettings, scene::MaterialManager& materialManager)
 {
-  m_renderSettings = renderSettings;
-  resize(materialManager, m_renderSize, m_uiSize, m_displaySize, true);
+  const auto previous = std::exchange(m_renderSettings, renderSettings);
+
+  // only rebuild the passes which depend on a changed setting
+  const bool compositionChanged = previous.dof != renderSettings.dof || previous.bloom != renderSettings.bloom
+                                  || previous.waterDenoise != renderSettings.waterDenoise;
+  const bool hbaoChanged = previous.hbaoResolutionDivisor != renderSettings.hbaoResolutionDivisor;
+  const bool worldEffectsChanged
+    = compositionChanged || hbaoChanged || previous.hbao != renderSettings.hbao
+      || previous.fxaaActive != renderSettings.fxaaActive
+      || previous.fxaaPreset != renderSettings.fxaaPreset || previous.lensDistortion != renderSettings.lensDistortion
+      || previous.velvia != renderSettings.velvia || previous.filmGrain != renderSettings.filmGrain;
+  const bool backbufferEffectsChanged
+    = previous.crtActive != renderSettings.crtActive || previous.crtVersion != renderSettings.crtVersion;
+
+  if(hbaoChanged)
+    initHBAO(materialManager);
+  if(compositionChanged)
+    initWorldComposition(materialManager);
+  if(worldEffectsChanged)
+    initWorldEffects(materialManager);
+  if(backbufferEffectsChanged)
+    initBackbufferEffects(materialManager);
+
+  m_renderTargetPool.collect();
 }
 
 void RenderPipeline::resize(scene::MaterialManager& materialManager,
@@ -106,31 +133,72 @@ void RenderPipeline::resize(scene::MaterialManager& materialManager,
                             const glm::ivec2& displayViewport,
                             bool force)
 {
-  if(!force && m_renderSize == renderViewport && m_uiSize == uiViewport && m_displaySize == displayViewport)
+  const bool renderSizeChanged = force || m_renderSize != renderViewport;
+  const bool displaySizeChanged = force || m_displaySize != displayViewport;
+  const bool uiSizeChanged = displaySizeChanged || m_uiSize != uiViewport;
+  if(!renderSizeChanged && !uiSizeChanged)
   {
     return;
   }
 
   m_renderSize = renderViewport;
+  m_renderRegion = RenderRegion{};
   m_uiSize = uiViewport;
   m_displaySize = displayViewport;
 
-  m_geometryPass = std::make_shared<pass::GeometryPass>(m_renderSize);
-  m_portalPass = std::make_shared<pass::PortalPass>(materialManager, m_geometryPass->getDepthBuffer(), m_renderSize);
-  m_hbaoPass = std::make_shared<pass::HBAOPass>(materialManager, m_renderSize / 4, *m_geometryPass);
-  m_worldCompositionPass = std::make_shared<pass::WorldCompositionPass>(
-    gsl::not_null{this}, materialManager, m_renderSettings, m_renderSize, *m_geometryPass, *m_portalPass);
-  m_uiPass = std::make_shared<pass::UIPass>(materialManager, m_uiSize, m_displaySize);
-
-  m_backbufferTextureHandle = std::make_shared<gl::TextureHandle<gl::Texture2D<gl::SRGB8>>>(
-    gsl::make_shared<gl::Texture2D<gl::SRGB8>>(m_displaySize, "backbuffer-texture"),
-    gsl::make_unique<gl::Sampler>("backbuffer-sampler"));
-  m_backbuffer = gl::FrameBufferBuilder{}
-                   .texture(gl::api::FramebufferAttachment::ColorAttachment0, m_backbufferTextureHandle->getTexture())
-                   .build("backbuffer");
-
-  initWorldEffects(materialManager);
-  initBackbufferEffects(materialManager);
+  if(renderSizeChanged)
+  {
+    m_geometryPass = std::make_shared<pass::GeometryPass>(m_renderSize);
+    m_hiZBuffer = std::make_shared<scene::HiZBuffer>(materialManager, m_geometryPass->getDepthBuffer());
+    m_portalPass = std::make_shared<pass::PortalPass>(materialManager, m_geometryPass->getDepthBuffer(), m_renderSize);
+    initHBAO(materialManager);
+    initWorldComposition(materialManager);
+    initWorldEffects(materialManager);
+  }
+
+  if(uiSizeChanged)
+    m_uiPass = std::make_shared<pass::UIPass>(materialManager, m_uiSize, m_displaySize);
+
+  if(displaySizeChanged)
+  {
+    m_backbufferEffects.clear();
+    m_backbufferTextureHandle = std::make_shared<gl::TextureHandle<gl::Texture2D<gl::SRGB8>>>(
+      gsl::make_shared<gl::Texture2D<gl::SRGB8>>(m_displaySize, "backbuffer-texture"),
+      gsl::make_unique<gl::Sampler>("backbuffer-sampler"));
+    m_backbuffer = gl::FrameBufferBuilder{}
+                     .texture(gl::api::FramebufferAttachment::ColorAttachment0, m_backbufferTextureHandle->getTexture())
+                     .build("backbuffer");
+    initBackbufferEffects(materialManager);
+  }
+
+  m_renderTargetPool.collect();
+}
+
+void RenderPipeline::initHBAO(scene::MaterialManager& materialManager)
+{
+  const auto divisor = std::clamp<int>(m_renderSettings.hbaoResolutionDivisor, 1, 8);
+  m_hbaoPass = std::make_shared<pass::HBAOPass>(
+    materialManager, glm::max(m_renderSize / divisor, glm::ivec2{1}), *m_geometryPass);
+}
+
+void RenderPipeline::initWorldComposition(scene::MaterialManager& materialManager)
+{
+  // release the old targets first so that the new passes can re-use them; the world effects read from the
+  // composition output, so they have to be rebuilt afterwards anyway
+  m_effects.clear();
+  m_worldCompositionPass.reset();
+  m_worldCompositionPass = std::make_shared<pass::WorldCompositionPass>(gsl::not_null{this},
+                                                                        m_renderTargetPool,
+                                                                        materialManager,
+                                                                        m_renderSettings,
+                                                                        m_renderSize,
+                                                                        *m_geometryPass,
+                                                                        *m_portalPass);
+}
+
+void RenderPipeline::setRenderRegion(const glm::ivec2& size)
+{
+  m_renderRegion = RenderRegion{m_renderSize, glm::min(size, m_renderSize)};
 }
 
 void RenderPipeline::initWorldEffects(scene::MaterialManager& materialManager)
@@ -140,32 +208,47 @@ void RenderPipeline::initWorldEffects(scene::MaterialManager& materialManager)
   auto fxSource = m_worldCompositionPass->getColorBuffer();
   auto addEffect = [this, &fxSource](const std::string& name, const gslu::nn_shared<scene::Material>& material)
   {
-    auto fx = std::make_shared<pass::EffectPass<gl::SRGB8>>(gsl::not_null{this}, "fx:" + name, material, fxSource);
+    auto fx = std::make_shared<pass::EffectPass<gl::SRGB8>>(
+      gsl::not_null{this}, m_renderTargetPool, "fx:" + name, material, fxSource);
     m_effects.emplace_back(fx);
     fxSource = fx->getOutput();
     return fx;
   };
 
-  if(m_renderSettings.hbao)
+  const auto bindAo = [texture = m_hbaoPass->getBlurredTexture(), position = m_geometryPass->getPositionBuffer()](
+                        const std::shared_ptr<pass::EffectPass<gl::SRGB8>>& fx)
   {
-    auto fx = addEffect("hbao", materialManager.getHBAOFx());
     fx->bind("u_ao",
-             [texture = m_hbaoPass->getBlurredTexture()](
-               const scene::Node* /*node*/, const scene::Mesh& /*mesh*/, gl::Uniform& uniform)
+             [texture](const scene::Node* /*node*/, const scene::Mesh& /*mesh*/, gl::Uniform& uniform)
              {
                uniform.set(texture);
              });
-  }
+    // the depth-aware upsampling of the occlusion needs the full resolution positions
+    fx->bind("u_position",
+             [position](const scene::Node* /*node*/, const scene::Mesh& /*mesh*/, gl::Uniform& uniform)
+             {
+               uniform.set(position);
+             });
+  };
 
+  // FXAA reads a neighbourhood of its input, so everything before it needs a pass of its own
   if(m_renderSettings.fxaaActive)
   {
+    if(m_renderSettings.hbao)
+      bindAo(addEffect("hbao", materialManager.getHBAOFx()));
+
     addEffect("fxaa", materialManager.getFXAA(m_renderSettings.fxaaPreset));
   }
 
-  addEffect("underwater-movement", materialManager.getUnderwaterMovement());
-
   {
-    auto fx = addEffect("reflective", materialManager.getReflective());
+    const bool fuseHbao = m_renderSettings.hbao && !m_renderSettings.fxaaActive;
+    auto fx = addEffect("world",
+                        materialManager.getWorldFx(fuseHbao,
+                                                   m_renderSettings.lensDistortion,
+                                                   m_renderSettings.velvia,
+                                                   m_renderSettings.filmGrain));
+    if(fuseHbao)
+      bindAo(fx);
     fx->bind("u_normal",
              [texture = m_geometryPass->getNormalBuffer()](
                const scene::Node* /*node*/, const scene::Mesh& /*mesh*/, gl::Uniform& uniform)
@@ -179,23 +262,6 @@ void RenderPipeline::initWorldEffects(scene::MaterialManager& materialManager)
                uniform.set(texture);
              });
   }
-
-  if(m_renderSettings.lensDistortion)
-  {
-    addEffect("lens", materialManager.getLensDistortion());
-  }
-
-  if(m_renderSettings.velvia)
-  {
-    addEffect("velvia", materialManager.getVelvia());
-  }
-
-  addEffect("death", materialManager.getDeath());
-
-  if(m_renderSettings.filmGrain)
-  {
-    addEffect("filmGrain", materialManager.getFilmGrain());
-  }
 }
 void RenderPipeline::initBackbufferEffects(scene::MaterialManager& materialManager)
 {
@@ -204,7 +270,8 @@ void RenderPipeline::initBackbufferEffects(scene::MaterialManager& materialManag
   auto fxSource = gsl::not_null{m_backbufferTextureHandle};
   auto addEffect = [this, &fxSource](const std::string& name, const gslu::nn_shared<scene::Material>& material)
   {
-    auto fx = std::make_shared<pass::EffectPass<gl::SRGB8>>(gsl::not_null{this}, "postfx:" + name, material, fxSource);
+    auto fx = std::make_shared<pass::EffectPass<gl::SRGB8>>(
+      gsl::not_null{this}, m_renderTargetPool, "postfx:" + name, material, fxSource);
     m_backbufferEffects.emplace_back(fx);
     fxSource = fx->getOutput();
     return fx;
@@ -229,7 +296,7 @@ void RenderPipeline::initBackbufferEffects(scene::MaterialManager& materialManag
 gl::RenderState RenderPipeline::bindPortalFrameBuffer()
 {
   BOOST_ASSERT(m_portalPass != nullptr);
-  return m_portalPass->bind();
+  return m_portalPass->bind(m_renderRegion);
 }
 
 void RenderPipeline::bindUiFrameBuffer()
@@ -245,7 +312,21 @@ void RenderPipeline::bindGeometryFrameBuffer(float farPlane)
   m_geometryPass->getPositionBuffer()->getTexture()->clear({0.0f, 0.0f, -farPlane});
   m_geometryPass->getReflectiveBuffer()->getTexture()->clear({0, 0, 0, 0});
   m_geometryPass->getDepthBuffer()->clear(gl::ScalarDepth{1.0f});
-  m_geometryPass->bind();
+  m_geometryPass->bind(m_renderRegion);
+}
+
+void RenderPipeline::updateHiZBuffer(const glm::mat4& viewProjection)
+{
+  BOOST_ASSERT(m_hiZBuffer != nullptr);
+  m_hiZBuffer->update(viewProjection, m_renderRegion);
+  BOOST_ASSERT(m_geometryPass != nullptr);
+  m_geometryPass->bind(m_renderRegion);
+}
+
+const scene::HiZBuffer& RenderPipeline::getHiZBuffer() const
+{
+  BOOST_ASSERT(m_hiZBuffer != nullptr);
+  return *m_hiZBuffer;
 }
 
 void RenderPipeline::renderUiFrameBuffer(float alpha)
@@ -268,11 +349,13 @@ void RenderPipeline::renderBackbufferEffects()
   auto finalOutput = m_backbuffer;
   for(const auto& effect : m_backbufferEffects)
   {
-    effect->render(false);
+    // the back buffer is re-created with the display size, so it is always covered completely
+    effect->render(false, RenderRegion{});
     finalOutput = effect->getFramebuffer();
   }
   gl::Framebuffer::unbindAll();
   finalOutput->blit(m_displaySize);
+  ++m_frameIndex;
 }
 
 void RenderPipeline::clearBackbuffer()
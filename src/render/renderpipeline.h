@@ -1,10 +1,14 @@
 #pragma once
 
+#include "pass/rendertargetpool.h"
+#include "renderregion.h"
 #include "rendersettings.h"
 
 #include <chrono>
+#include <cstdint>
 #include <gl/pixel.h>
 #include <gl/soglb_fwd.h>
+#include <glm/mat4x4.hpp>
 #include <glm/vec2.hpp>
 #include <gsl/gsl-lite.hpp>
 #include <gslu.h>
@@ -15,6 +19,7 @@ namespace render::scene
 {
 class MaterialManager;
 class Camera;
+class HiZBuffer;
 } // namespace render::scene
 
 namespace engine::world
@@ -41,11 +46,16 @@ private:
   const std::chrono::high_resolution_clock::time_point m_creationTime = std::chrono::high_resolution_clock::now();
 
   RenderSettings m_renderSettings{};
+  //! @brief Number of presented frames
+  uint64_t m_frameIndex = 0;
+  pass::RenderTargetPool m_renderTargetPool{};
   glm::ivec2 m_renderSize{-1};
+  RenderRegion m_renderRegion{};
   glm::ivec2 m_uiSize{-1};
   glm::ivec2 m_displaySize{-1};
   std::shared_ptr<pass::PortalPass> m_portalPass;
   std::shared_ptr<pass::GeometryPass> m_geometryPass;
+  std::shared_ptr<scene::HiZBuffer> m_hiZBuffer;
   std::shared_ptr<pass::HBAOPass> m_hbaoPass;
   std::shared_ptr<pass::WorldCompositionPass> m_worldCompositionPass;
   std::shared_ptr<pass::UIPass> m_uiPass;
@@ -56,6 +66,8 @@ private:
   std::vector<gslu::nn_shared<pass::EffectPass<gl::SRGB8>>> m_backbufferEffects{};
 
   void initBackbufferEffects(scene::MaterialManager& materialManager);
+  void initHBAO(scene::MaterialManager& materialManager);
+  void initWorldComposition(scene::MaterialManager& materialManager);
   void initWorldEffects(scene::MaterialManager& materialManager);
 
 public:
@@ -65,6 +77,9 @@ public:
                           const glm::ivec2& displayViewport);
 
   void bindGeometryFrameBuffer(float farPlane);
+  //! @brief Builds the occlusion data from the depth rendered so far, and re-binds the geometry frame buffer.
+  void updateHiZBuffer(const glm::mat4& viewProjection);
+  [[nodiscard]] const scene::HiZBuffer& getHiZBuffer() const;
   [[nodiscard]] gl::RenderState bindPortalFrameBuffer();
   void bindUiFrameBuffer();
   void renderUiFrameBuffer(float alpha);
@@ -72,12 +87,18 @@ public:
 
   void updateCamera(const gslu::nn_shared<scene::Camera>& camera);
 
+  //! @param renderViewport The size the world render targets are allocated for; the world is rendered to the part
+  //!                       of them set with setRenderRegion().
   void resize(scene::MaterialManager& materialManager,
               const glm::ivec2& renderViewport,
               const glm::ivec2& uiViewport,
               const glm::ivec2& displayViewport,
               bool force = false);
 
+  //! @brief Sets the size of the rendered world image, which must not exceed the allocated render size.
+  //! @details Changing it only changes the viewports of the world passes, so it is cheap enough to be done per frame.
+  void setRenderRegion(const glm::ivec2& size);
+
   void apply(const RenderSettings& renderSettings, scene::MaterialManager& materialManager);
 
   [[nodiscard]] auto getLocalTime() const
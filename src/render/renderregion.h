@@ -0,0 +1,53 @@
+#pragma once
+
+#include <glm/common.hpp>
+#include <glm/vec2.hpp>
+#include <gsl/gsl-lite.hpp>
+
+namespace render
+{
+//! @brief The part of the render targets covered by the rendered image.
+//! @details The render targets are allocated for the maximum render size, and a lower dynamic render scale only
+//!          shrinks the covered part instead of re-creating the targets. The covered part starts at the lower left
+//!          corner; its texture coordinates are in the range from 0 to getUvScale().
+class RenderRegion final
+{
+public:
+  //! @brief A region covering the whole targets.
+  RenderRegion() = default;
+
+  explicit RenderRegion(const glm::ivec2& allocatedSize, const glm::ivec2& size)
+      : m_allocatedSize{allocatedSize}
+      , m_size{size}
+  {
+    Expects(size.x > 0 && size.y > 0);
+    Expects(size.x <= allocatedSize.x && size.y <= allocatedSize.y);
+  }
+
+  [[nodiscard]] glm::vec2 getUvScale() const noexcept
+  {
+    return glm::vec2{m_size} / glm::vec2{m_allocatedSize};
+  }
+
+  //! @brief The covered part of a target, which may be a down-scaled version of the allocated size.
+  [[nodiscard]] glm::ivec2 getViewport(const glm::ivec2& targetSize) const noexcept
+  {
+    // round up so that down-scaled targets cover the whole region
+    return glm::max((targetSize * m_size + m_allocatedSize - glm::ivec2{1}) / m_allocatedSize, glm::ivec2{1});
+  }
+
+  [[nodiscard]] bool operator==(const RenderRegion& rhs) const noexcept
+  {
+    return m_allocatedSize == rhs.m_allocatedSize && m_size == rhs.m_size;
+  }
+
+  [[nodiscard]] bool operator!=(const RenderRegion& rhs) const noexcept
+  {
+    return !(*this == rhs);
+  }
+
+private:
+  glm::ivec2 m_allocatedSize{1};
+  glm::ivec2 m_size{1};
+};
+} // namespace render
@@ -19,6 +19,7 @@ void RenderSettings::serialize(const serialization::Serializer<engine::EngineCon
       S_NVO("bilinearFiltering", bilinearFiltering),
       S_NVO("waterDenoise", waterDenoise),
       S_NVO("hbao", hbao),
+      S_NVO("hbaoResolutionDivisor", hbaoResolutionDivisor),
       S_NVO("velvia", velvia),
       S_NVO("fxaaActive", fxaaActive),
       S_NVO("fxaaPreset", fxaaPreset),
@@ -27,12 +28,17 @@ void RenderSettings::serialize(const serialization::Serializer<engine::EngineCon
       S_NVO("dustActive", dustActive),
       S_NVO("dustDensity", dustDensity),
       S_NVO("highQualityShadows", highQualityShadows),
+      S_NVO("occlusionCulling", occlusionCulling),
       S_NVO("anisotropyLevel", anisotropyLevel),
       S_NVO("anisotropyActive", anisotropyActive),
       S_NVO("renderResolutionDivisor", renderResolutionDivisor),
       S_NVO("renderResolutionDivisorActive", renderResolutionDivisorActive),
+      S_NVO("dynamicResolution", dynamicResolution),
+      S_NVO("dynamicResolutionMinPercent", dynamicResolutionMinPercent),
+      S_NVO("dynamicResolutionMaxPercent", dynamicResolutionMaxPercent),
       S_NVO("uiScaleMultiplier", uiScaleMultiplier),
       S_NVO("uiScaleActive", uiScaleActive),
-      S_NVO("glidosPack", glidosPack));
+      S_NVO("glidosPack", glidosPack),
+      S_NVO("shaderWarmUp", shaderWarmUp));
 }
 } // namespace render
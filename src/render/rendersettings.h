@@ -28,6 +28,8 @@ struct RenderSettings
   bool anisotropyActive = true;
   bool waterDenoise = false;
   bool hbao = true;
+  //! @brief HBAO is calculated at the render resolution divided by this
+  uint8_t hbaoResolutionDivisor = 4;
   bool velvia = true;
   bool fxaaActive = true;
   uint8_t fxaaPreset = 39;
@@ -36,11 +38,19 @@ struct RenderSettings
   bool dustActive = true;
   uint8_t dustDensity = 1;
   bool highQualityShadows = true;
+  //! @brief Skip objects hidden behind room geometry
+  bool occlusionCulling = true;
   uint8_t renderResolutionDivisor = 2;
   bool renderResolutionDivisorActive = false;
+  //! @brief Adapt the render scale to the measured GPU frame time, within the given percentage bounds
+  bool dynamicResolution = false;
+  uint8_t dynamicResolutionMinPercent = 50;
+  uint8_t dynamicResolutionMaxPercent = 100;
   uint8_t uiScaleMultiplier = 2;
   bool uiScaleActive = false;
   std::optional<std::string> glidosPack = std::nullopt;
+  //! @brief Link all shader programs the settings need up front instead of on first appearance
+  bool shaderWarmUp = true;
 
   [[nodiscard]] size_t getLightCollectionDepth() const
   {
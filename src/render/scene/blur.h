@@ -3,6 +3,7 @@
 #include "material.h"
 #include "materialmanager.h"
 #include "mesh.h"
+#include "render/renderregion.h"
 #include "rendercontext.h"
 #include "shaderprogram.h"
 #include "uniformparameter.h"
@@ -55,9 +56,10 @@ public:
     m_mesh->getRenderState().setViewport(src->getTexture()->size() / m_downscale);
   }
 
-  void render() const
+  void render(const RenderRegion& region) const
   {
     SOGLB_DEBUGGROUP(m_name + "/blur-pass");
+    setRenderRegion(*m_mesh, region, m_blurredTexture->getTexture()->size());
     RenderContext context{RenderMode::Full, std::nullopt};
     m_framebuffer->bind();
     m_mesh->render(nullptr, context);
@@ -106,10 +108,10 @@ public:
     m_blur2.setInput(m_blur1.getBlurredTexture());
   }
 
-  void render()
+  void render(const RenderRegion& region)
   {
-    m_blur1.render();
-    m_blur2.render();
+    m_blur1.render(region);
+    m_blur2.render(region);
   }
 
   [[nodiscard]] auto getBlurredTexture() const
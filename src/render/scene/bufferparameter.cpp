@@ -52,12 +52,15 @@ void BufferParameter::bindBoneTransformBuffer()
 gl::ShaderStorageBlock*
   BufferParameter::findShaderStorageBlock(const gslu::nn_shared<ShaderProgram>& shaderProgram) const
 {
-  if(const auto block = shaderProgram->findShaderStorageBlock(getName()))
-    return block;
+  if(isResolvedFor(shaderProgram))
+    return m_shaderStorageBlock;
 
-  BOOST_LOG_TRIVIAL(warning) << "Shader storage block '" << getName() << "' not found in program '"
-                             << shaderProgram->getId() << "'";
+  m_shaderStorageBlock = shaderProgram->findShaderStorageBlock(getName());
+  setResolvedFor(shaderProgram);
+  if(m_shaderStorageBlock == nullptr)
+    BOOST_LOG_TRIVIAL(warning) << "Shader storage block '" << getName() << "' not found in program '"
+                               << shaderProgram->getId() << "'";
 
-  return nullptr;
+  return m_shaderStorageBlock;
 }
 } // namespace render::scene
@@ -63,5 +63,6 @@ private:
     findShaderStorageBlock(const gslu::nn_shared<ShaderProgram>& shaderProgram) const;
 
   std::function<BufferBinder> m_bufferBinder;
+  mutable gl::ShaderStorageBlock* m_shaderStorageBlock = nullptr;
 };
 } // namespace render::scene
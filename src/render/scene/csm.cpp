@@ -5,10 +5,12 @@
 #include "materialgroup.h"
 #include "materialmanager.h"
 #include "mesh.h"
+#include "render/renderregion.h"
 #include "rendercontext.h"
 #include "rendermode.h"
 
 #include <algorithm>
+#include <cmath>
 #include <gl/buffer.h>
 #include <gl/debuggroup.h>
 #include <gl/framebuffer.h>
@@ -22,15 +24,14 @@
 #include <gl/texturehandle.h>
 #include <glm/common.hpp>
 #include <glm/ext/matrix_clip_space.hpp>
+#include <glm/geometric.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <gslu.h>
-#include <limits>
 #include <optional>
 #include <string>
 #include <utility>
-#include <vector>
 
 namespace render::scene
 {
@@ -98,7 +99,8 @@ void CSM::Split::renderSquare()
 void CSM::Split::renderBlur()
 {
   SOGLB_DEBUGGROUP("vsm-blur-pass");
-  squareBlur->render();
+  // the shadow maps are always rendered completely
+  squareBlur->render(RenderRegion{});
 }
 
 CSM::CSM(int32_t resolution, MaterialManager& materialManager)
@@ -170,36 +172,36 @@ std::array<glm::mat4, CSMBuffer::NSplits> CSM::getMatrices(const glm::mat4& mode
 
 void CSM::updateCamera(const Camera& camera)
 {
-  //Start off by calculating the split distances
+  static_assert(CSMBuffer::NSplits > 1);
+
+  // blend of logarithmic and linear split distances ("practical split scheme")
+  static constexpr float SplitLambda = 0.5f;
+  // far splits cover more than their frustum slice, so they only need to move after the camera moved for a while
+  static constexpr float FarSplitMargin = 0.25f;
+  // avoids extent changes from rounding errors when the camera rotates
+  static constexpr float RadiusQuantum = 16.0f;
+
   const float nearClip = camera.getNearPlane();
   const float farClip = camera.getFarPlane();
 
-  std::vector<float> cascadeSplits;
-  cascadeSplits.emplace_back(nearClip);
-#if 0
-  for(size_t i = 0; i < m_splits.size(); ++i)
-  {
-    static constexpr float Lambda = 0.9f;
-    const auto ir = static_cast<float>(i + 1) / static_cast<float>(m_splits.size());
-    const float zi
-      = Lambda * nearClip * std::pow(farClip / nearClip, ir) + (1.0f - Lambda) * (nearClip + ir * (farClip - nearClip));
-    cascadeSplits.emplace_back(zi);
-    m_splits[i].end = -zi;
-  }
-#else
+  std::array<float, CSMBuffer::NSplits + 1> cascadeSplits{};
+  cascadeSplits[0] = nearClip;
   for(size_t i = 0; i < m_splits.size(); ++i)
   {
     const auto ir = static_cast<float>(i + 1) / static_cast<float>(m_splits.size());
-    const auto zi = nearClip + ir * (farClip - nearClip);
-    cascadeSplits.emplace_back(zi);
+    cascadeSplits[i + 1] = SplitLambda * nearClip * std::pow(farClip / nearClip, ir)
+                           + (1.0f - SplitLambda) * (nearClip + ir * (farClip - nearClip));
   }
-#endif
 
   const auto position = camera.getPosition();
   const auto up = camera.getUpVector();
   const auto right = camera.getRightVector();
   const auto forward = camera.getFrontVector();
 
+  const auto lightViewWS = glm::lookAt(glm::vec3{0.0f}, m_lightDir, m_lightDirOrtho);
+  const auto refreshedFarSplit = 1 + m_updateCounter % (m_splits.size() - 1);
+  ++m_updateCounter;
+
   for(size_t cascadeIterator = 0; cascadeIterator < m_splits.size(); ++cascadeIterator)
   {
     const auto nc = position + forward * cascadeSplits[cascadeIterator];
@@ -222,25 +224,38 @@ void CSM::updateCamera(const Camera& camera)
       nc - up * Hnear + right * Wnear,
     };
 
-    // calculate frustum bbox as seen from the light
-    const auto lightViewWS = glm::lookAt(glm::vec3{0.0f}, m_lightDir, m_lightDirOrtho);
+    // bound the frustum slice by a sphere, so that the extent does not change when the camera rotates
+    glm::vec3 center{0.0f};
+    for(const auto& corner : frustumCorners)
+      center += corner;
+    center /= static_cast<float>(frustumCorners.size());
 
-    glm::vec3 bboxMin{std::numeric_limits<float>::max()};
-    glm::vec3 bboxMax{std::numeric_limits<float>::lowest()};
+    float radius = 0.0f;
     for(const auto& corner : frustumCorners)
-    {
-      const auto cornerLS = glm::vec3{lightViewWS * glm::vec4{corner, 1.0f}};
-      bboxMin = glm::min(bboxMin, cornerLS);
-      bboxMax = glm::max(bboxMax, cornerLS);
-    }
-
-    // extend the bboxes and snap to a grid to avoid shadow jumping
-    static constexpr float SnapSize = 512.0f;
-    bboxMin = glm::floor(bboxMin / SnapSize) * SnapSize;
-    bboxMax = glm::ceil(bboxMax / SnapSize) * SnapSize;
-
-    m_splits[cascadeIterator].vpMatrix
-      = glm::ortho(bboxMin.x, bboxMax.x, bboxMin.y, bboxMax.y, -bboxMax.z, -bboxMin.z) * lightViewWS;
+      radius = std::max(radius, glm::distance(corner, center));
+    radius = glm::ceil(radius / RadiusQuantum) * RadiusQuantum;
+
+    // snap the center to whole texels (or whole margins for the far splits) to avoid shadow shimmering
+    const float margin = cascadeIterator == 0 ? 0.0f : radius * FarSplitMargin;
+    const float extent = radius + margin;
+    const float texelSize = 2 * extent / static_cast<float>(m_resolution);
+    const float snapSize = std::max(texelSize, glm::floor(margin / texelSize) * texelSize);
+    auto centerLS = glm::vec3{lightViewWS * glm::vec4{center, 1.0f}};
+    centerLS = glm::round(centerLS / snapSize) * snapSize;
+
+    const auto vpMatrix = glm::ortho(centerLS.x - extent,
+                                     centerLS.x + extent,
+                                     centerLS.y - extent,
+                                     centerLS.y + extent,
+                                     -centerLS.z - extent,
+                                     -centerLS.z + extent)
+                          * lightViewWS;
+
+    // casters may move anywhere, so the near split is always updated, and the far splits take turns
+    auto& split = m_splits[cascadeIterator];
+    split.needsUpdate
+      = cascadeIterator == 0 || cascadeIterator == refreshedFarSplit || split.vpMatrix != vpMatrix;
+    split.vpMatrix = vpMatrix;
   }
 }
 
@@ -52,6 +52,8 @@ public:
     mutable std::unique_ptr<gl::FenceSync> depthSync;
     mutable std::unique_ptr<gl::FenceSync> squareSync;
     mutable std::unique_ptr<gl::FenceSync> blurSync;
+    //! @brief Whether the shadow map must be rendered this frame; if not, it still matches vpMatrix
+    bool needsUpdate = true;
 
     void init(int32_t resolution, size_t idx, MaterialManager& materialManager);
     void renderSquare();
@@ -123,6 +125,11 @@ public:
     m_activeSplit = idx;
   }
 
+  [[nodiscard]] bool activeSplitNeedsUpdate() const
+  {
+    return m_splits.at(m_activeSplit).needsUpdate;
+  }
+
   void updateCamera(const Camera& camera);
 
   gl::UniformBuffer<CSMBuffer>& getBuffer(const glm::mat4& modelMatrix);
@@ -145,6 +152,8 @@ private:
   const glm::vec3 m_lightDirOrtho{core::TRVec{1_len, 0_len, 0_len}.toRenderSystem()};
   std::array<Split, CSMBuffer::NSplits> m_splits;
   size_t m_activeSplit = 0;
+  //! @brief Drives the round-robin refresh of the far splits
+  size_t m_updateCounter = 0;
   CSMBuffer m_bufferData;
   gl::UniformBuffer<CSMBuffer> m_buffer{"csm-data-ubo"};
 };
@@ -0,0 +1,230 @@
+#include "hizbuffer.h"
+
+#include "material.h"
+#include "materialmanager.h"
+#include "mesh.h"
+#include "render/renderregion.h"
+#include "rendercontext.h"
+#include "rendermode.h"
+
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <gl/debuggroup.h>
+#include <gl/fencesync.h>
+#include <gl/framebuffer.h>
+#include <gl/renderstate.h>
+#include <gl/sampler.h>
+#include <gl/texture2d.h>
+#include <gl/texturedepth.h>
+#include <gl/texturehandle.h>
+#include <glm/common.hpp>
+#include <glm/vec4.hpp>
+#include <gsl/gsl-lite.hpp>
+#include <string>
+
+namespace render::scene
+{
+namespace
+{
+glm::ivec2 getReducedSize(const glm::ivec2& depthSize)
+{
+  return (depthSize + glm::ivec2{HiZBuffer::TileSize - 1}) / HiZBuffer::TileSize;
+}
+} // namespace
+
+HiZBuffer::Readback::Readback(const std::string& label)
+    : buffer{label}
+{
+}
+
+HiZBuffer::Readback::~Readback() = default;
+
+HiZBuffer::HiZBuffer(MaterialManager& materialManager, const gslu::nn_shared<gl::TextureDepth<float>>& depthBuffer)
+    : m_depthSize{depthBuffer->size()}
+    , m_depthHandle{gsl::make_shared<gl::TextureHandle<gl::TextureDepth<float>>>(
+        depthBuffer,
+        gsl::make_unique<gl::Sampler>("hiz-depth-sampler") | set(gl::api::TextureMinFilter::Nearest)
+          | set(gl::api::TextureMagFilter::Nearest))}
+    , m_reduced{std::make_shared<gl::Texture2D<gl::Scalar32F>>(getReducedSize(m_depthSize), "hiz-reduced")}
+    , m_fb{gl::FrameBufferBuilder()
+             .textureNoBlend(gl::api::FramebufferAttachment::ColorAttachment0, m_reduced)
+             .build("hiz-fb")}
+    , m_mesh{createScreenQuad(materialManager.getHiZReduce(), "hiz")}
+{
+  m_mesh->bind("u_depth",
+               [this](const Node* /*node*/, const Mesh& /*mesh*/, gl::Uniform& uniform)
+               {
+                 uniform.set(m_depthHandle);
+               });
+  m_mesh->getRenderState().merge(m_fb->getRenderState());
+
+  const auto reducedSize = m_reduced->size();
+  const std::vector<float> empty(gsl::narrow<size_t>(reducedSize.x * reducedSize.y), 1.0f);
+  for(size_t i = 0; i < Latency; ++i)
+  {
+    m_readbacks[i] = std::make_unique<Readback>("hiz-readback-" + std::to_string(i));
+    m_readbacks[i]->buffer.setData(empty, gl::api::BufferUsage::StreamRead);
+  }
+
+  for(auto size = reducedSize;; size = glm::max((size + glm::ivec2{1}) / 2, glm::ivec2{1}))
+  {
+    m_levelSizes.emplace_back(size);
+    m_levels.emplace_back(gsl::narrow<size_t>(size.x * size.y), 1.0f);
+    if(size.x == 1 && size.y == 1)
+      break;
+  }
+}
+
+HiZBuffer::~HiZBuffer() = default;
+
+void HiZBuffer::update(const glm::mat4& viewProjection, const RenderRegion& region)
+{
+  SOGLB_DEBUGGROUP("hiz-pass");
+
+  // use the newest finished reduction, older ones are outdated by it
+  bool collected = false;
+  for(size_t i = 1; i <= Latency; ++i)
+  {
+    auto& pending = *m_readbacks[(m_frame + Latency - i) % Latency];
+    if(pending.sync == nullptr)
+      continue;
+
+    if(collected)
+      pending.sync.reset();
+    else if(pending.sync->isSignaled())
+    {
+      collect(pending);
+      collected = true;
+    }
+  }
+
+  // the oldest readback is re-used for this frame
+  auto& readback = *m_readbacks[m_frame % Latency];
+  readback.sync.reset();
+
+  m_fb->bind();
+  setRenderRegion(*m_mesh, region, m_reduced->size());
+  RenderContext context{RenderMode::Full, std::nullopt};
+  m_mesh->render(nullptr, context);
+
+  readback.buffer.bind();
+  GL_ASSERT(gl::api::getTextureImage(m_reduced->getHandle(),
+                                     0,
+                                     gl::api::PixelFormat::Red,
+                                     gl::api::PixelType::Float,
+                                     gsl::narrow<gl::api::core::SizeType>(readback.buffer.size() * sizeof(float)),
+                                     nullptr));
+  readback.buffer.unbind();
+  readback.sync = std::make_unique<gl::FenceSync>();
+  readback.viewProjection = viewProjection;
+  readback.depthRegionSize = region.getViewport(m_depthSize);
+
+  ++m_frame;
+}
+
+void HiZBuffer::collect(Readback& readback)
+{
+  BOOST_ASSERT(readback.sync != nullptr);
+  readback.sync.reset();
+
+  const auto data = readback.buffer.map();
+  std::copy(data.begin(), data.end(), m_levels[0].begin());
+  readback.buffer.unmap();
+
+  m_viewProjection = readback.viewProjection;
+  m_depthRegionSize = readback.depthRegionSize;
+  buildPyramid();
+}
+
+void HiZBuffer::buildPyramid()
+{
+  for(size_t level = 1; level < m_levels.size(); ++level)
+  {
+    const auto& src = m_levels[level - 1];
+    const auto srcSize = m_levelSizes[level - 1];
+    auto& dst = m_levels[level];
+    const auto dstSize = m_levelSizes[level];
+
+    for(int y = 0; y < dstSize.y; ++y)
+    {
+      for(int x = 0; x < dstSize.x; ++x)
+      {
+        float depth = 0;
+        for(int dy = 0; dy < 2; ++dy)
+        {
+          for(int dx = 0; dx < 2; ++dx)
+          {
+            const auto sx = std::min(2 * x + dx, srcSize.x - 1);
+            const auto sy = std::min(2 * y + dy, srcSize.y - 1);
+            depth = std::max(depth, src[gsl::narrow_cast<size_t>(sy * srcSize.x + sx)]);
+          }
+        }
+        dst[gsl::narrow_cast<size_t>(y * dstSize.x + x)] = depth;
+      }
+    }
+  }
+}
+
+bool HiZBuffer::isOccluded(const glm::mat4& modelMatrix, const glm::vec3& min, const glm::vec3& max) const
+{
+  if(!m_viewProjection.has_value())
+    return false;
+
+  const auto mvp = *m_viewProjection * modelMatrix;
+  glm::vec2 ndcMin{1.0f};
+  glm::vec2 ndcMax{-1.0f};
+  float nearestDepth = 1.0f;
+  for(const auto& x : {min.x, max.x})
+  {
+    for(const auto& y : {min.y, max.y})
+    {
+      for(const auto& z : {min.z, max.z})
+      {
+        const auto clip = mvp * glm::vec4{x, y, z, 1.0f};
+        // the box crosses the near plane, so it is in front of everything
+        if(clip.w <= 0)
+          return false;
+
+        const auto ndc = glm::vec3{clip} / clip.w;
+        ndcMin = glm::min(ndcMin, glm::vec2{ndc});
+        ndcMax = glm::max(ndcMax, glm::vec2{ndc});
+        nearestDepth = std::min(nearestDepth, ndc.z * 0.5f + 0.5f);
+      }
+    }
+  }
+
+  if(ndcMin.x > 1 || ndcMin.y > 1 || ndcMax.x < -1 || ndcMax.y < -1)
+    return false;
+
+  const auto toTexel = [this](const glm::vec2& ndc)
+  {
+    const auto pixel
+      = (glm::clamp(ndc, glm::vec2{-1.0f}, glm::vec2{1.0f}) * 0.5f + 0.5f) * glm::vec2{m_depthRegionSize};
+    return glm::min(glm::ivec2{pixel} / TileSize, m_levelSizes[0] - glm::ivec2{1});
+  };
+
+  // use the finest level in which the box covers at most 2x2 texels
+  auto texelMin = toTexel(ndcMin);
+  auto texelMax = toTexel(ndcMax);
+  size_t level = 0;
+  while(level + 1 < m_levels.size() && (texelMax.x - texelMin.x > 1 || texelMax.y - texelMin.y > 1))
+  {
+    texelMin /= 2;
+    texelMax /= 2;
+    ++level;
+  }
+
+  const auto& depths = m_levels[level];
+  const auto size = m_levelSizes[level];
+  for(int y = texelMin.y; y <= texelMax.y; ++y)
+  {
+    for(int x = texelMin.x; x <= texelMax.x; ++x)
+    {
+      if(nearestDepth <= depths[gsl::narrow_cast<size_t>(y * size.x + x)])
+        return false;
+    }
+  }
+
+  return true;
+}
+} // namespace render::scene
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <gl/buffer.h>
+#include <gl/pixel.h>
+#include <gl/soglb_fwd.h>
+#include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <gslu.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace render
+{
+class RenderRegion;
+}
+
+namespace render::scene
+{
+class MaterialManager;
+class Mesh;
+
+//! @brief A coarse maximum depth pyramid of the occluding geometry, used to skip nodes hidden behind it.
+//! @details The depth buffer is reduced on the GPU and read back asynchronously. The remaining levels of the pyramid
+//!          are built on the CPU. Occlusion tests are done against the pyramid of a previous frame with the camera of
+//!          that frame, so a node may become visible a few frames late when it moves into view from behind an
+//!          occluder.
+class HiZBuffer final
+{
+public:
+  static constexpr int TileSize = 16;
+  static constexpr size_t Latency = 3;
+
+  explicit HiZBuffer(MaterialManager& materialManager, const gslu::nn_shared<gl::TextureDepth<float>>& depthBuffer);
+  ~HiZBuffer();
+
+  //! @brief Reduces the covered part of the depth buffer, and collects the reductions of earlier frames.
+  void update(const glm::mat4& viewProjection, const RenderRegion& region);
+
+  //! @brief Tests whether a model space box is behind the occluders.
+  [[nodiscard]] bool isOccluded(const glm::mat4& modelMatrix, const glm::vec3& min, const glm::vec3& max) const;
+
+private:
+  struct Readback
+  {
+    explicit Readback(const std::string& label);
+    ~Readback();
+
+    gl::Buffer<float, gl::api::BufferTarget::PixelPackBuffer> buffer;
+    std::unique_ptr<gl::FenceSync> sync;
+    glm::mat4 viewProjection{1.0f};
+    glm::ivec2 depthRegionSize{0};
+  };
+
+  const glm::ivec2 m_depthSize;
+  const gslu::nn_shared<gl::TextureHandle<gl::TextureDepth<float>>> m_depthHandle;
+  const gslu::nn_shared<gl::Texture2D<gl::Scalar32F>> m_reduced;
+  const gslu::nn_shared<gl::Framebuffer> m_fb;
+  const gslu::nn_shared<Mesh> m_mesh;
+
+  std::array<std::unique_ptr<Readback>, Latency> m_readbacks;
+  size_t m_frame = 0;
+
+  //! @brief Maximum depth per texel; level 0 is the GPU reduction, each further level halves the size.
+  std::vector<std::vector<float>> m_levels;
+  std::vector<glm::ivec2> m_levelSizes;
+  std::optional<glm::mat4> m_viewProjection;
+  //! @brief The covered part of the depth buffer the pyramid was built from.
+  glm::ivec2 m_depthRegionSize{0};
+
+  void collect(Readback& readback);
+  void buildPyramid();
+};
+} // namespace render::scene
@@ -4,6 +4,7 @@
 #include "csm.h"
 #include "material.h"
 #include "node.h"
+#include "render/rendersettings.h"
 #include "renderer.h"
 #include "shadercache.h"
 #include "uniformparameter.h"
@@ -22,6 +23,7 @@
 #include <gl/texturehandle.h>
 #include <glm/vec2.hpp>
 #include <gslu.h>
+#include <initializer_list>
 #include <random>
 #include <utility>
 #include <vector>
@@ -42,12 +44,13 @@ void configureForScreenSpaceEffect(Material& m, bool enableBlend)
 }
 } // namespace
 
-gslu::nn_shared<Material> MaterialManager::getSprite(bool billboard)
+gslu::nn_shared<Material> MaterialManager::getSprite(bool billboard, bool instanced)
 {
-  if(auto it = m_sprite.find(billboard); it != m_sprite.end())
+  const std::tuple key{billboard, instanced};
+  if(auto it = m_sprite.find(key); it != m_sprite.end())
     return it->second;
 
-  auto m = gsl::make_shared<Material>(m_shaderCache->getGeometry(false, false, true, billboard ? 2 : 1));
+  auto m = gsl::make_shared<Material>(m_shaderCache->getGeometry(false, false, true, billboard ? 2 : 1, instanced));
   m->getRenderState().setCullFace(false);
 
   m->getUniformBlock("Transform")->bindTransformBuffer();
@@ -59,7 +62,7 @@ gslu::nn_shared<Material> MaterialManager::getSprite(bool billboard)
         uniform.set(gsl::not_null{m_geometryTextures});
       });
 
-  m_sprite.emplace(billboard, m);
+  m_sprite.emplace(key, m);
   return m;
 }
 
@@ -116,7 +119,7 @@ gslu::nn_shared<Material> MaterialManager::getGeometry(bool inWater, bool skelet
   if(auto it = m_geometry.find(key); it != m_geometry.end())
     return it->second;
 
-  auto m = gsl::make_shared<Material>(m_shaderCache->getGeometry(inWater, skeletal, roomShadowing, 0));
+  auto m = gsl::make_shared<Material>(m_shaderCache->getGeometry(inWater, skeletal, roomShadowing, 0, false));
   m->getUniform("u_diffuseTextures")
     ->bind(
       [this](const Node* /*node*/, const Mesh& /*mesh*/, gl::Uniform& uniform)
@@ -339,49 +342,20 @@ gslu::nn_shared<Material> MaterialManager::getCRTV1()
   return m;
 }
 
-gslu::nn_shared<Material> MaterialManager::getVelvia()
+gslu::nn_shared<Material> MaterialManager::getWorldFx(bool hbao, bool lensDistortion, bool velvia, bool filmGrain)
 {
-  if(m_velvia != nullptr)
-    return gsl::not_null{m_velvia};
-
-  auto m = gsl::make_shared<Material>(m_shaderCache->getVelvia());
-  configureForScreenSpaceEffect(*m, false);
-  m_velvia = m;
-  return m;
-}
-
-gslu::nn_shared<Material> MaterialManager::getDeath()
-{
-  if(m_death != nullptr)
-    return gsl::not_null{m_death};
-
-  auto m = gsl::make_shared<Material>(m_shaderCache->getDeath());
-  configureForScreenSpaceEffect(*m, false);
-  m_death = m;
-  return m;
-}
-
-gslu::nn_shared<Material> MaterialManager::getFilmGrain()
-{
-  if(m_filmGrain != nullptr)
-    return gsl::not_null{m_filmGrain};
+  const std::tuple key{hbao, lensDistortion, velvia, filmGrain};
+  if(auto it = m_worldFx.find(key); it != m_worldFx.end())
+    return it->second;
 
-  auto m = gsl::make_shared<Material>(m_shaderCache->getFilmGrain());
-  m->getUniform("u_noise")->set(gsl::not_null{m_noiseTexture});
+  auto m = gsl::make_shared<Material>(m_shaderCache->getWorldFx(hbao, lensDistortion, velvia, filmGrain));
+  if(lensDistortion)
+    m->getUniformBlock("Camera")->bindCameraBuffer(m_renderer->getCamera());
+  if(filmGrain)
+    m->getUniform("u_noise")->set(gsl::not_null{m_noiseTexture});
+  m->getUniform("u_strength")->set(m_deathStrength);
   configureForScreenSpaceEffect(*m, false);
-  m_filmGrain = m;
-  return m;
-}
-
-gslu::nn_shared<Material> MaterialManager::getLensDistortion()
-{
-  if(m_lensDistortion != nullptr)
-    return gsl::not_null{m_lensDistortion};
-
-  auto m = gsl::make_shared<Material>(m_shaderCache->getLensDistortion());
-  m->getUniformBlock("Camera")->bindCameraBuffer(m_renderer->getCamera());
-
-  m_lensDistortion = m;
+  m_worldFx.emplace(key, m);
   return m;
 }
 
@@ -395,27 +369,6 @@ gslu::nn_shared<Material> MaterialManager::getHBAOFx()
   return m;
 }
 
-gslu::nn_shared<Material> MaterialManager::getUnderwaterMovement()
-{
-  if(m_underwaterMovement != nullptr)
-    return gsl::not_null{m_underwaterMovement};
-
-  auto m = gsl::make_shared<Material>(m_shaderCache->getUnderwaterMovement());
-  m_underwaterMovement = m;
-  return m;
-}
-
-gslu::nn_shared<Material> MaterialManager::getReflective()
-{
-  if(m_reflective != nullptr)
-    return gsl::not_null{m_reflective};
-
-  auto m = gsl::make_shared<Material>(m_shaderCache->getReflective());
-  configureForScreenSpaceEffect(*m, false);
-  m_reflective = m;
-  return m;
-}
-
 gslu::nn_shared<Material> MaterialManager::getBloom()
 {
   if(m_bloom != nullptr)
@@ -461,6 +414,17 @@ gslu::nn_shared<Material> MaterialManager::getVSMSquare()
   return m;
 }
 
+gslu::nn_shared<Material> MaterialManager::getHiZReduce()
+{
+  if(m_hiZReduce != nullptr)
+    return gsl::not_null{m_hiZReduce};
+
+  auto m = gsl::make_shared<Material>(m_shaderCache->getHiZReduce());
+  configureForScreenSpaceEffect(*m, false);
+  m_hiZReduce = m;
+  return m;
+}
+
 void MaterialManager::setGeometryTextures(
   std::shared_ptr<gl::TextureHandle<gl::Texture2DArray<gl::PremultipliedSRGBA8>>> geometryTextures)
 {
@@ -541,7 +505,35 @@ gslu::nn_shared<Material> MaterialManager::getDustParticle()
 
 void MaterialManager::setDeathStrength(float strength)
 {
-  auto m = getDeath();
-  m->getUniform("u_strength")->set(strength);
+  m_deathStrength = strength;
+  for(const auto& [key, m] : m_worldFx)
+    m->getUniform("u_strength")->set(strength);
+}
+
+void MaterialManager::warmUp(const RenderSettings& renderSettings)
+{
+  // the programs are what is expensive, and the materials need level data, so only the programs are created here
+  for(const bool flag : {false, true})
+  {
+    (void)m_shaderCache->getCSMDepthOnly(flag);
+    (void)m_shaderCache->getDepthOnly(flag);
+    for(const bool skeletal : {false, true})
+    {
+      for(const bool roomShadowing : {false, true})
+        (void)m_shaderCache->getGeometry(flag, skeletal, roomShadowing, 0, false);
+    }
+  }
+  for(const uint8_t spriteMode : {1, 2})
+  {
+    for(const bool instanced : {false, true})
+      (void)m_shaderCache->getGeometry(false, false, true, spriteMode, instanced);
+  }
+
+  (void)m_shaderCache->getGhost();
+  (void)m_shaderCache->getWaterSurface();
+  (void)m_shaderCache->getLightning();
+  (void)m_shaderCache->getUi();
+  if(renderSettings.dustActive)
+    (void)m_shaderCache->getDustParticle();
 }
 } // namespace render::scene
@@ -10,6 +10,11 @@
 #include <optional>
 #include <tuple>
 
+namespace render
+{
+struct RenderSettings;
+}
+
 namespace render::scene
 {
 class CSM;
@@ -22,7 +27,8 @@ class MaterialManager final
 public:
   explicit MaterialManager(gslu::nn_shared<ShaderCache> shaderCache, gslu::nn_shared<Renderer> renderer);
 
-  [[nodiscard]] gslu::nn_shared<Material> getSprite(bool billboard);
+  //! @brief Sprite material; instanced sprites read their offset and brightness from the @c b_instances buffer
+  [[nodiscard]] gslu::nn_shared<Material> getSprite(bool billboard, bool instanced = false);
 
   [[nodiscard]] gslu::nn_shared<Material> getCSMDepthOnly(bool skeletal);
   [[nodiscard]] gslu::nn_shared<Material> getDepthOnly(bool skeletal);
@@ -43,13 +49,9 @@ public:
   [[nodiscard]] gslu::nn_shared<Material> getFXAA(uint8_t preset);
   [[nodiscard]] gslu::nn_shared<Material> getCRTV0();
   [[nodiscard]] gslu::nn_shared<Material> getCRTV1();
-  [[nodiscard]] gslu::nn_shared<Material> getVelvia();
-  [[nodiscard]] gslu::nn_shared<Material> getDeath();
-  [[nodiscard]] gslu::nn_shared<Material> getFilmGrain();
-  [[nodiscard]] gslu::nn_shared<Material> getLensDistortion();
+  //! @brief Per-pixel world effects fused into a single pass, with the death effect and underwater movement always on
+  [[nodiscard]] gslu::nn_shared<Material> getWorldFx(bool hbao, bool lensDistortion, bool velvia, bool filmGrain);
   [[nodiscard]] gslu::nn_shared<Material> getHBAOFx();
-  [[nodiscard]] gslu::nn_shared<Material> getUnderwaterMovement();
-  [[nodiscard]] gslu::nn_shared<Material> getReflective();
   [[nodiscard]] gslu::nn_shared<Material> getBloom();
   [[nodiscard]] gslu::nn_shared<Material> getBloomFilter();
 
@@ -57,6 +59,7 @@ public:
   [[nodiscard]] gslu::nn_shared<Material> getBackdrop(bool withAlphaMultiplier);
   [[nodiscard]] gslu::nn_shared<Material> getHBAO();
   [[nodiscard]] gslu::nn_shared<Material> getVSMSquare();
+  [[nodiscard]] gslu::nn_shared<Material> getHiZReduce();
   [[nodiscard]] gslu::nn_shared<Material> getFastGaussBlur(uint8_t extent, uint8_t blurDir, uint8_t blurDim);
   [[nodiscard]] gslu::nn_shared<Material> getFastBoxBlur(uint8_t extent, uint8_t blurDir, uint8_t blurDim);
 
@@ -71,6 +74,9 @@ public:
 
   void setDeathStrength(float strength);
 
+  //! @brief Links the scene shader programs that would otherwise be linked on their first appearance in a level
+  void warmUp(const RenderSettings& renderSettings);
+
 private:
   const gslu::nn_shared<ShaderCache> m_shaderCache;
   std::shared_ptr<gl::TextureHandle<gl::Texture2D<gl::RGB8>>> m_noiseTexture;
@@ -78,17 +84,13 @@ private:
   std::map<uint8_t, gslu::nn_shared<Material>> m_fxaa{};
   std::shared_ptr<Material> m_crtV0{nullptr};
   std::shared_ptr<Material> m_crtV1{nullptr};
-  std::shared_ptr<Material> m_velvia{nullptr};
-  std::shared_ptr<Material> m_death{nullptr};
-  std::shared_ptr<Material> m_filmGrain{nullptr};
-  std::shared_ptr<Material> m_lensDistortion{nullptr};
+  std::map<std::tuple<bool, bool, bool, bool>, gslu::nn_shared<Material>> m_worldFx{};
+  float m_deathStrength = 0.0f;
   std::shared_ptr<Material> m_hbaoFx{nullptr};
-  std::shared_ptr<Material> m_underwaterMovement{nullptr};
-  std::shared_ptr<Material> m_reflective{nullptr};
   std::shared_ptr<Material> m_bloom{nullptr};
   std::shared_ptr<Material> m_bloomFilter{nullptr};
 
-  std::map<bool, gslu::nn_shared<Material>> m_sprite{};
+  std::map<std::tuple<bool, bool>, gslu::nn_shared<Material>> m_sprite{};
   std::map<bool, gslu::nn_shared<Material>> m_csmDepthOnly{};
   std::map<bool, gslu::nn_shared<Material>> m_depthOnly{};
   std::map<std::tuple<bool, bool, bool>, gslu::nn_shared<Material>> m_geometry{};
@@ -103,6 +105,7 @@ private:
   std::map<bool, gslu::nn_shared<Material>> m_backdrop{};
   std::shared_ptr<Material> m_hbao{nullptr};
   std::shared_ptr<Material> m_vsmSquare{nullptr};
+  std::shared_ptr<Material> m_hiZReduce{nullptr};
 
   std::shared_ptr<Material> m_dustParticle{nullptr};
 
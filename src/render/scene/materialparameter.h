@@ -2,6 +2,8 @@
 
 #include <gsl/gsl-lite.hpp>
 #include <gslu.h>
+#include <memory>
+#include <string>
 
 namespace render::scene
 {
@@ -26,7 +28,22 @@ public:
     return m_name;
   }
 
+protected:
+  //! @brief Whether the program interface of this parameter was already looked up by name in @p shaderProgram
+  [[nodiscard]] bool isResolvedFor(const gslu::nn_shared<ShaderProgram>& shaderProgram) const
+  {
+    const std::shared_ptr<ShaderProgram>& program = shaderProgram.get();
+    return !m_resolvedProgram.owner_before(program) && !program.owner_before(m_resolvedProgram);
+  }
+
+  void setResolvedFor(const gslu::nn_shared<ShaderProgram>& shaderProgram) const
+  {
+    m_resolvedProgram = shaderProgram.get();
+  }
+
 private:
   const std::string m_name;
+  //! @brief Compared by ownership, so that a new program at the address of a destroyed one is not mistaken for it
+  mutable std::weak_ptr<ShaderProgram> m_resolvedProgram;
 };
 } // namespace render::scene
@@ -3,6 +3,7 @@
 #include "material.h"
 #include "materialgroup.h"
 #include "names.h"
+#include "render/renderregion.h"
 #include "rendercontext.h"
 #include "rendermode.h"
 #include "shaderprogram.h"
@@ -10,6 +11,7 @@
 #include <array>
 #include <cstdint>
 #include <gl/buffer.h>
+#include <gl/program.h>
 #include <gl/renderstate.h>
 #include <gl/vertexarray.h>
 #include <gl/vertexbuffer.h>
@@ -58,6 +60,16 @@ gslu::nn_shared<Mesh> createScreenQuad(const glm::vec2& xy,
   return mesh;
 }
 
+void setRenderRegion(Mesh& mesh, const RenderRegion& region, const glm::ivec2& targetSize)
+{
+  mesh.getRenderState().setViewport(region.getViewport(targetSize));
+  mesh.bind("u_uvScale",
+            [uvScale = region.getUvScale()](const Node* /*node*/, const Mesh& /*mesh*/, gl::Uniform& uniform)
+            {
+              uniform.set(uvScale);
+            });
+}
+
 Mesh::~Mesh() = default;
 
 void Mesh::render(const Node* node, RenderContext& context)
@@ -72,7 +84,10 @@ void Mesh::render(const Node* node, RenderContext& context)
 
   material->bind(node, *this);
 
-  drawIndexBuffer(m_primitiveType);
+  if(m_instanceCount == 1)
+    drawIndexBuffer(m_primitiveType);
+  else
+    drawIndexBuffer(m_primitiveType, m_instanceCount);
 
   context.popState();
   context.popState();
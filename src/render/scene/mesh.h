@@ -13,6 +13,11 @@
 #include <string>
 #include <utility>
 
+namespace render
+{
+class RenderRegion;
+}
+
 namespace render::scene
 {
 class RenderContext;
@@ -46,11 +51,19 @@ public:
     return m_materialGroup;
   }
 
+  //! @brief Draws the mesh @p instanceCount times per render call; the material must provide the instance data
+  void setInstanceCount(gl::api::core::SizeType instanceCount)
+  {
+    Expects(instanceCount > 0);
+    m_instanceCount = instanceCount;
+  }
+
   void render(const Node* node, RenderContext& context) final;
 
 private:
   MaterialGroup m_materialGroup{};
   const gl::api::PrimitiveType m_primitiveType{};
+  gl::api::core::SizeType m_instanceCount = 1;
 
   virtual void drawIndexBuffer(gl::api::PrimitiveType primitiveType) = 0;
   virtual void drawIndexBuffer(gl::api::PrimitiveType primitiveType, gl::api::core::SizeType instanceCount) = 0;
@@ -103,4 +116,8 @@ inline gslu::nn_shared<Mesh> createScreenQuad(const std::shared_ptr<Material>& m
 {
   return createScreenQuad({0, 0}, {0, 0}, material, label);
 }
+
+//! @brief Restricts a screen quad to the covered part of its render target, and maps its texture coordinates to the
+//!        covered part of its inputs.
+extern void setRenderRegion(Mesh& mesh, const RenderRegion& region, const glm::ivec2& targetSize);
 } // namespace render::scene
@@ -17,5 +17,6 @@
 #define VERTEX_ATTRIBUTE_QUAD_VERT4 "a_quadVert4"
 #define VERTEX_ATTRIBUTE_QUAD_UV12 "a_quadUv12"
 #define VERTEX_ATTRIBUTE_QUAD_UV34 "a_quadUv34"
+#define VERTEX_ATTRIBUTE_TEXTURE_ANIMATION "a_textureAnimation"
 
 #define VERTEX_ATTRIBUTE_REFLECTIVE_NAME "a_reflective"
@@ -14,6 +14,7 @@
 #include <gsl/gsl-lite.hpp>
 #include <gslu.h>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -165,6 +166,17 @@ public:
     return false;
   }
 
+  //! @brief Model space bounds of the node's geometry; nodes without bounds are never occlusion culled.
+  [[nodiscard]] virtual std::optional<std::tuple<glm::vec3, glm::vec3>> getLocalBounds() const
+  {
+    return m_localBounds;
+  }
+
+  void setLocalBounds(const glm::vec3& min, const glm::vec3& max)
+  {
+    m_localBounds = std::tuple{min, max};
+  }
+
   void clear()
   {
     auto tmp = m_children;
@@ -244,6 +256,7 @@ private:
   mutable gl::UniformBuffer<Transform> m_transformBuffer;
 
   std::vector<std::tuple<glm::vec2, glm::vec2>> m_scissors;
+  std::optional<std::tuple<glm::vec3, glm::vec3>> m_localBounds;
 
   int m_renderOrder = 0;
 
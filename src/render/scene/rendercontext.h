@@ -11,6 +11,8 @@
 
 namespace render::scene
 {
+class HiZBuffer;
+
 class RenderContext final
 {
 public:
@@ -55,9 +57,20 @@ public:
     return m_renderStates.top();
   }
 
+  [[nodiscard]] const HiZBuffer* getHiZBuffer() const noexcept
+  {
+    return m_hiZBuffer;
+  }
+
+  void setHiZBuffer(const HiZBuffer* hiZBuffer) noexcept
+  {
+    m_hiZBuffer = hiZBuffer;
+  }
+
 private:
   std::stack<gl::RenderState> m_renderStates{};
   const RenderMode m_renderMode;
   const std::optional<glm::mat4> m_viewProjection;
+  const HiZBuffer* m_hiZBuffer = nullptr;
 };
 } // namespace render::scene
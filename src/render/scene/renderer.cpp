@@ -27,10 +27,11 @@ Renderer::Renderer(gslu::nn_shared<Camera> camera)
 
 Renderer::~Renderer() = default;
 
-void Renderer::render()
+void Renderer::render(const HiZBuffer* hiZBuffer)
 {
   {
     RenderContext context{RenderMode::Full, std::nullopt};
+    context.setHiZBuffer(hiZBuffer);
     Visitor visitor{context};
     m_rootNode->accept(visitor);
     visitor.render(m_camera->getPosition());
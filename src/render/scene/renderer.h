@@ -11,6 +11,7 @@
 namespace render::scene
 {
 class Camera;
+class HiZBuffer;
 class Node;
 
 class Renderer final
@@ -30,7 +31,8 @@ public:
     return std::chrono::high_resolution_clock::now() - m_constructionTime.time_since_epoch();
   }
 
-  void render();
+  //! @param hiZBuffer if set, nodes hidden behind the occluders in it are skipped
+  void render(const HiZBuffer* hiZBuffer = nullptr);
 
   void clear(const gl::api::core::Bitfield<gl::api::ClearBufferMask>& flags,
              const gl::SRGBA8& clearColor,
@@ -5,9 +5,19 @@
 #include <algorithm>
 #include <boost/algorithm/string/join.hpp>
 #include <boost/log/trivial.hpp>
+#include <cstddef>
+#include <fstream>
+#include <gl/api/gl.hpp>
+#include <gl/glassert.h>
+#include <gl/program.h>
 #include <gl/shader.h>
 #include <gslu.h>
+#include <iomanip>
 #include <iosfwd>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <system_error>
 
 namespace render::scene
 {
@@ -47,8 +57,107 @@ std::string makeId(const std::filesystem::path& shaderPath, std::vector<std::str
   id += boost::algorithm::join(defines, ";");
   return id;
 }
+
+std::string getGlString(gl::api::StringName name)
+{
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return reinterpret_cast<const char*>(GL_ASSERT_FN(gl::api::getString(name)));
+}
+
+std::optional<gl::ProgramBinary> readProgramBinary(const std::filesystem::path& path, const size_t key)
+{
+  std::ifstream stream{path, std::ios::in | std::ios::binary};
+  if(!stream.is_open())
+    return std::nullopt;
+
+  size_t storedKey = 0;
+  gl::ProgramBinary binary;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  if(!stream.read(reinterpret_cast<char*>(&storedKey), sizeof(storedKey)) || storedKey != key)
+    return std::nullopt;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  if(!stream.read(reinterpret_cast<char*>(&binary.format), sizeof(binary.format)))
+    return std::nullopt;
+
+  binary.data.assign(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{});
+  if(binary.data.empty())
+    return std::nullopt;
+
+  return binary;
+}
+
+void writeProgramBinary(const std::filesystem::path& path, const size_t key, const gl::ProgramBinary& binary)
+{
+  if(binary.data.empty())
+    return;
+
+  std::error_code ec;
+  std::filesystem::create_directories(path.parent_path(), ec);
+  std::ofstream stream{path, std::ios::out | std::ios::binary | std::ios::trunc};
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  stream.write(reinterpret_cast<const char*>(&key), sizeof(key));
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  stream.write(reinterpret_cast<const char*>(&binary.format), sizeof(binary.format));
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  stream.write(reinterpret_cast<const char*>(binary.data.data()), gsl::narrow<std::streamsize>(binary.data.size()));
+  if(!stream)
+    BOOST_LOG_TRIVIAL(warning) << "Failed to write shader program binary " << path;
+}
 } // namespace
 
+ShaderCache::ShaderCache(std::filesystem::path root, std::filesystem::path binaryRoot)
+    : m_root{std::move(root)}
+    , m_binaryRoot{std::move(binaryRoot)}
+    , m_driverId{getGlString(gl::api::StringName::Vendor) + ";" + getGlString(gl::api::StringName::Renderer) + ";"
+                 + getGlString(gl::api::StringName::Version)}
+{
+}
+
+gslu::nn_shared<ShaderProgram> ShaderCache::link(const std::string& programId,
+                                                 const std::initializer_list<std::string_view>& sources,
+                                                 const std::function<gl::Program()>& linker)
+{
+  if(m_binaryRoot.empty())
+  {
+    auto shader = gsl::make_shared<ShaderProgram>(programId, linker());
+    m_programs.emplace(programId, shader);
+    return shader;
+  }
+
+  std::string keySource = m_driverId;
+  keySource += '\n';
+  keySource += programId;
+  for(const auto& source : sources)
+  {
+    keySource += '\0';
+    keySource += source;
+  }
+  const auto key = std::hash<std::string>{}(keySource);
+
+  std::ostringstream fileName;
+  fileName << std::hex << std::setw(sizeof(size_t) * 2) << std::setfill('0') << std::hash<std::string>{}(programId)
+           << ".bin";
+  const auto binaryPath = m_binaryRoot / fileName.str();
+
+  if(const auto binary = readProgramBinary(binaryPath, key); binary.has_value())
+  {
+    if(gl::Program program{programId, *binary}; program.getLinkStatus())
+    {
+      BOOST_LOG_TRIVIAL(debug) << "Loaded shader program " << programId << " from " << binaryPath;
+      auto shader = gsl::make_shared<ShaderProgram>(programId, std::move(program));
+      m_programs.emplace(programId, shader);
+      return shader;
+    }
+
+    BOOST_LOG_TRIVIAL(info) << "Driver rejected cached binary of shader program " << programId << ", recompiling";
+  }
+
+  auto shader = gsl::make_shared<ShaderProgram>(programId, linker());
+  writeProgramBinary(binaryPath, key, shader->getHandle().getBinary());
+  m_programs.emplace(programId, shader);
+  return shader;
+}
+
 gslu::nn_shared<ShaderProgram> ShaderCache::get(const std::filesystem::path& vshPath,
                                                 const std::filesystem::path& fshPath,
                                                 const std::vector<std::string>& defines)
@@ -59,11 +168,16 @@ gslu::nn_shared<ShaderProgram> ShaderCache::get(const std::filesystem::path& vsh
   if(it != m_programs.end())
     return it->second;
 
-  auto vert = gl::VertexShader::create(m_root / vshPath, defines, makeId(vshPath, defines));
-  auto frag = gl::FragmentShader::create(m_root / fshPath, defines, makeId(fshPath, defines));
-  auto shader = gsl::make_shared<ShaderProgram>(programId, vert, frag);
-  m_programs.emplace(programId, shader);
-  return shader;
+  const auto vshSource = gl::readShaderSource(m_root / vshPath);
+  const auto fshSource = gl::readShaderSource(m_root / fshPath);
+  return link(programId,
+              {vshSource, fshSource},
+              [&]()
+              {
+                const auto vert = gl::VertexShader::create({}, vshSource, defines, makeId(vshPath, defines));
+                const auto frag = gl::FragmentShader::create({}, fshSource, defines, makeId(fshPath, defines));
+                return gl::Program{programId, vert, frag};
+              });
 }
 
 gslu::nn_shared<ShaderProgram> ShaderCache::get(const std::filesystem::path& vshPath,
@@ -77,11 +191,17 @@ gslu::nn_shared<ShaderProgram> ShaderCache::get(const std::filesystem::path& vsh
   if(it != m_programs.end())
     return it->second;
 
-  auto vert = gl::VertexShader::create(m_root / vshPath, defines, makeId(vshPath, defines));
-  auto frag = gl::FragmentShader::create(m_root / fshPath, defines, makeId(fshPath, defines));
-  auto geom = gl::GeometryShader::create(m_root / geomPath, defines, makeId(geomPath, defines));
-  auto shader = gsl::make_shared<ShaderProgram>(programId, vert, frag, geom);
-  m_programs.emplace(programId, shader);
-  return shader;
+  const auto vshSource = gl::readShaderSource(m_root / vshPath);
+  const auto fshSource = gl::readShaderSource(m_root / fshPath);
+  const auto geomSource = gl::readShaderSource(m_root / geomPath);
+  return link(programId,
+              {vshSource, fshSource, geomSource},
+              [&]()
+              {
+                const auto vert = gl::VertexShader::create({}, vshSource, defines, makeId(vshPath, defines));
+                const auto frag = gl::FragmentShader::create({}, fshSource, defines, makeId(fshPath, defines));
+                const auto geom = gl::GeometryShader::create({}, geomSource, defines, makeId(geomPath, defines));
+                return gl::Program{programId, vert, frag, geom};
+              });
 }
 } // namespace render::scene
@@ -2,10 +2,14 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <functional>
+#include <gl/soglb_fwd.h>
 #include <gsl/gsl-lite.hpp>
 #include <gslu.h>
+#include <initializer_list>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -19,12 +23,18 @@ class ShaderCache final
   std::unordered_map<std::string, gslu::nn_shared<ShaderProgram>> m_programs{};
 
   const std::filesystem::path m_root;
+  //! @brief Where linked program binaries are persisted; disabled if empty
+  const std::filesystem::path m_binaryRoot;
+  //! @brief Identifies the driver the binaries were built by, as binaries are only valid for the same driver build
+  const std::string m_driverId;
+
+  //! @brief Loads the program from the binary cache if its sources and the driver are unchanged, and links it otherwise
+  [[nodiscard]] gslu::nn_shared<ShaderProgram> link(const std::string& programId,
+                                                    const std::initializer_list<std::string_view>& sources,
+                                                    const std::function<gl::Program()>& linker);
 
 public:
-  explicit ShaderCache(std::filesystem::path root)
-      : m_root{std::move(root)}
-  {
-  }
+  explicit ShaderCache(std::filesystem::path root, std::filesystem::path binaryRoot = {});
 
   [[nodiscard]] gslu::nn_shared<ShaderProgram> get(const std::filesystem::path& vshPath,
                                                    const std::filesystem::path& fshPath,
@@ -55,7 +65,7 @@ public:
     return get("backdrop.vert", "flat.frag", defines);
   }
 
-  [[nodiscard]] auto getGeometry(bool inWater, bool skeletal, bool roomShadowing, uint8_t spriteMode)
+  [[nodiscard]] auto getGeometry(bool inWater, bool skeletal, bool roomShadowing, uint8_t spriteMode, bool instanced)
   {
     std::vector<std::string> defines;
     if(inWater)
@@ -65,6 +75,8 @@ public:
     if(roomShadowing)
       defines.emplace_back("ROOM_SHADOWING");
     defines.emplace_back("SPRITEMODE " + std::to_string(int(spriteMode)));
+    if(instanced)
+      defines.emplace_back("INSTANCED");
     return get("geometry.vert", "geometry.frag", defines);
   }
 
@@ -105,24 +117,18 @@ public:
     return get("flat.vert", "fx_crt_v1.frag");
   }
 
-  [[nodiscard]] auto getVelvia()
-  {
-    return get("flat.vert", "fx_velvia.frag");
-  }
-
-  [[nodiscard]] auto getDeath()
-  {
-    return get("flat.vert", "fx_death.frag");
-  }
-
-  [[nodiscard]] auto getFilmGrain()
-  {
-    return get("flat.vert", "fx_film_grain.frag");
-  }
-
-  [[nodiscard]] auto getLensDistortion()
+  [[nodiscard]] auto getWorldFx(bool hbao, bool lensDistortion, bool velvia, bool filmGrain)
   {
-    return get("flat.vert", "fx_lens_distortion.frag");
+    std::vector<std::string> defines;
+    if(hbao)
+      defines.emplace_back("HBAO");
+    if(lensDistortion)
+      defines.emplace_back("LENS_DISTORTION");
+    if(velvia)
+      defines.emplace_back("VELVIA");
+    if(filmGrain)
+      defines.emplace_back("FILM_GRAIN");
+    return get("flat.vert", "fx_world.frag", defines);
   }
 
   [[nodiscard]] auto getHBAOFx()
@@ -130,21 +136,11 @@ public:
     return get("flat.vert", "fx_hbao.frag");
   }
 
-  [[nodiscard]] auto getUnderwaterMovement()
-  {
-    return get("flat.vert", "fx_underwater_movement.frag");
-  }
-
   [[nodiscard]] auto getHBAO()
   {
     return get("flat.vert", "hbao.frag");
   }
 
-  [[nodiscard]] auto getReflective()
-  {
-    return get("flat.vert", "fx_reflective.frag");
-  }
-
   [[nodiscard]] auto getBloom()
   {
     return get("flat.vert", "fx_bloom.frag");
@@ -178,6 +174,11 @@ public:
     return get("flat.vert", "vsm_square.frag");
   }
 
+  [[nodiscard]] auto getHiZReduce()
+  {
+    return get("flat.vert", "hiz_reduce.frag");
+  }
+
   [[nodiscard]] auto getWorldComposition(bool inWater, bool dof)
   {
     std::vector<std::string> defines;
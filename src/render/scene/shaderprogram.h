@@ -13,6 +13,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace render::scene
@@ -22,11 +23,16 @@ class ShaderProgram
 public:
   template<gl::api::ShaderType... Types>
   explicit ShaderProgram(const std::string_view& label, const gl::Shader<Types>&... shaders)
-      : m_handle{label, shaders...}
-      , m_id{label}
+      : ShaderProgram{label, gl::Program{label, shaders...}}
   {
     static_assert(sizeof...(Types) > 0);
+  }
 
+  //! @brief Takes ownership of an already linked program
+  explicit ShaderProgram(const std::string_view& label, gl::Program&& handle)
+      : m_handle{std::move(handle)}
+      , m_id{label}
+  {
     if(const auto log = m_handle.getInfoLog(); !log.empty())
       BOOST_LOG_TRIVIAL(debug) << "Shader program info log: " << log;
 
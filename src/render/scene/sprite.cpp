@@ -78,6 +78,12 @@ gslu::nn_shared<Mesh> createSpriteMesh(const float x0,
   return mesh;
 }
 
+gslu::nn_shared<Mesh> createInstancedSpriteMesh(const gslu::nn_shared<Material>& materialFull, const std::string& label)
+{
+  // the vertex shader interpolates the frame's corners and texture coordinates of an instance with these weights
+  return createSpriteMesh(0, 0, 1, 1, {0, 0}, {1, 1}, materialFull, 0, label);
+}
+
 gl::VertexLayout<SpriteVertex> SpriteVertex::getLayout()
 {
   return {
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <gl/vertexbuffer.h>
+#include <glm/mat4x4.hpp>
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
@@ -9,6 +11,7 @@
 #include <gslu.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace render::scene
 {
@@ -26,6 +29,42 @@ struct SpriteVertex
   [[nodiscard]] static gl::VertexLayout<SpriteVertex> getLayout();
 };
 
+struct SpriteFrame
+{
+  float x0;
+  float y0;
+  float x1;
+  float y1;
+  glm::vec2 t0;
+  glm::vec2 t1;
+  int textureIdx;
+};
+
+//! @brief Per-instance data of instanced sprite meshes, matching the b_instances layout in transform_interface.glsl
+struct SpriteInstance
+{
+  //! @brief Rotation and offset relative to the model transform
+  glm::mat4 transform{1.0f};
+  //! @brief The quad corners x0, y0, x1, y1 of the drawn sprite frame
+  glm::vec4 rect{0.0f};
+  //! @brief The texture coordinates u0, v0, u1, v1 at the quad corners
+  glm::vec4 uv{0.0f};
+  float brightness = 1.0f;
+  int32_t textureIdx = 0;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+  int32_t _pad[2]{0, 0};
+
+  explicit SpriteInstance(const SpriteFrame& frame, const glm::mat4& transform, float brightness)
+      : transform{transform}
+      , rect{frame.x0, frame.y0, frame.x1, frame.y1}
+      , uv{frame.t0, frame.t1}
+      , brightness{brightness}
+      , textureIdx{frame.textureIdx}
+  {
+  }
+};
+static_assert(sizeof(SpriteInstance) == 112, "Invalid SpriteInstance struct size");
+
 extern gslu::nn_shared<Mesh> createSpriteMesh(float x0,
                                               float y0,
                                               float x1,
@@ -35,4 +74,8 @@ extern gslu::nn_shared<Mesh> createSpriteMesh(float x0,
                                               const gslu::nn_shared<Material>& materialFull,
                                               int textureIdx,
                                               const std::string& label);
+
+//! @brief Creates a unit quad mesh; it must be drawn instanced, as each instance stretches it to its sprite frame.
+extern gslu::nn_shared<Mesh> createInstancedSpriteMesh(const gslu::nn_shared<Material>& materialFull,
+                                                       const std::string& label);
 } // namespace render::scene
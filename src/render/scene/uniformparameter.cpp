@@ -38,12 +38,16 @@ bool UniformParameter::bind(const Node* node, const Mesh& mesh, const gslu::nn_s
 
 gl::Uniform* UniformParameter::findUniform(const gslu::nn_shared<ShaderProgram>& shaderProgram) const
 {
-  if(const auto uniform = shaderProgram->findUniform(getName()))
-    return uniform;
+  if(isResolvedFor(shaderProgram))
+    return m_uniform;
 
-  BOOST_LOG_TRIVIAL(warning) << "Uniform '" << getName() << "' not found in program '" << shaderProgram->getId() << "'";
+  m_uniform = shaderProgram->findUniform(getName());
+  setResolvedFor(shaderProgram);
+  if(m_uniform == nullptr)
+    BOOST_LOG_TRIVIAL(warning) << "Uniform '" << getName() << "' not found in program '" << shaderProgram->getId()
+                               << "'";
 
-  return nullptr;
+  return m_uniform;
 }
 
 bool UniformBlockParameter::bind(const Node* node,
@@ -93,12 +97,15 @@ void UniformBlockParameter::bindCameraBuffer(const gslu::nn_shared<Camera>& came
 
 gl::UniformBlock* UniformBlockParameter::findUniformBlock(const gslu::nn_shared<ShaderProgram>& shaderProgram) const
 {
-  if(const auto block = shaderProgram->findUniformBlock(getName()))
-    return block;
+  if(isResolvedFor(shaderProgram))
+    return m_uniformBlock;
 
-  BOOST_LOG_TRIVIAL(warning) << "Uniform block '" << getName() << "' not found in program '" << shaderProgram->getId()
-                             << "'";
+  m_uniformBlock = shaderProgram->findUniformBlock(getName());
+  setResolvedFor(shaderProgram);
+  if(m_uniformBlock == nullptr)
+    BOOST_LOG_TRIVIAL(warning) << "Uniform block '" << getName() << "' not found in program '"
+                               << shaderProgram->getId() << "'";
 
-  return nullptr;
+  return m_uniformBlock;
 }
 } // namespace render::scene
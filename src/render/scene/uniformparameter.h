@@ -74,6 +74,7 @@ private:
   [[nodiscard]] gl::Uniform* findUniform(const gslu::nn_shared<ShaderProgram>& shaderProgram) const;
 
   std::function<UniformValueSetter> m_valueSetter;
+  mutable gl::Uniform* m_uniform = nullptr;
 };
 
 class UniformBlockParameter : public MaterialParameter
@@ -123,5 +124,6 @@ private:
   [[nodiscard]] gl::UniformBlock* findUniformBlock(const gslu::nn_shared<ShaderProgram>& shaderProgram) const;
 
   std::function<BufferBinder> m_bufferBinder;
+  mutable gl::UniformBlock* m_uniformBlock = nullptr;
 };
 } // namespace render::scene
@@ -1,5 +1,6 @@
 #include "visitor.h"
 
+#include "hizbuffer.h"
 #include "node.h"
 #include "renderable.h"
 #include "rendercontext.h"
@@ -10,8 +11,10 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace render::scene
 {
@@ -21,6 +24,16 @@ void Visitor::visit(const Node& node)
     return;
   if(const auto& vp = m_context.getViewProjection(); vp.has_value() && node.canBeCulled(vp.value()))
     return;
+  // only leaves are tested, as the bounds of a node do not cover its children
+  if(const auto hiZBuffer = m_context.getHiZBuffer(); hiZBuffer != nullptr && node.getChildren().empty())
+  {
+    if(const auto bounds = node.getLocalBounds(); bounds.has_value())
+    {
+      const auto& [min, max] = *bounds;
+      if(hiZBuffer->isOccluded(node.getModelMatrix(), min, max))
+        return;
+    }
+  }
 
   m_context.pushState(node.getRenderState());
   node.accept(*this);
@@ -37,21 +50,23 @@ void Visitor::render(const std::optional<glm::vec3>& camera) const
 {
   if(camera.has_value())
   {
-    // logic: first order by render order, then order by distance to camera back-to-front
-    std::sort(m_nodes.begin(),
-              m_nodes.end(),
-              [camera](const RenderableInfo& a, const RenderableInfo& b)
-              {
-                if(auto aOrder = std::get<0>(a)->getRenderOrder(), bOrder = std::get<0>(b)->getRenderOrder();
-                   aOrder != bOrder)
-                {
-                  return aOrder < bOrder;
-                }
+    // logic: first order by render order, then order by distance to camera back-to-front.
+    // the sort keys are calculated once per node instead of twice per comparison; the node index makes the
+    // order of equal keys deterministic.
+    std::vector<std::tuple<int, float, size_t>> sortKeys;
+    sortKeys.reserve(m_nodes.size());
+    for(size_t i = 0; i < m_nodes.size(); ++i)
+    {
+      const auto& [node, state, position] = m_nodes[i];
+      sortKeys.emplace_back(node->getRenderOrder(), -glm::distance(position, *camera), i);
+    }
+    std::sort(sortKeys.begin(), sortKeys.end());
 
-                auto da = glm::distance(std::get<2>(a), *camera);
-                auto db = glm::distance(std::get<2>(b), *camera);
-                return da > db;
-              });
+    std::vector<RenderableInfo> sortedNodes;
+    sortedNodes.reserve(m_nodes.size());
+    for(const auto& [order, distance, i] : sortKeys)
+      sortedNodes.emplace_back(std::move(m_nodes[i]));
+    m_nodes = std::move(sortedNodes);
   }
 
   for(const auto& [node, state, position] : m_nodes)
@@ -0,0 +1,175 @@
+#define BOOST_TEST_MODULE render
+
+#include "dynamicresolution.h"
+#include "pass/basicrendertargetpool.h"
+#include "renderregion.h"
+
+#include <boost/test/unit_test.hpp>
+#include <cstddef>
+#include <glm/vec2.hpp>
+#include <string>
+#include <utility>
+
+namespace
+{
+struct FakeTexture
+{
+  virtual ~FakeTexture() = default;
+};
+
+template<typename TPixel>
+struct FakeTarget final : FakeTexture
+{
+  explicit FakeTarget(const glm::ivec2& size, std::string label)
+      : size{size}
+      , label{std::move(label)}
+  {
+  }
+
+  glm::ivec2 size;
+  std::string label;
+};
+
+using FakeRenderTargetPool = render::pass::BasicRenderTargetPool<FakeTexture, FakeTarget>;
+
+void addFrameTimes(render::DynamicResolution& dynamicResolution, const size_t count, const float frameTimeMs)
+{
+  for(size_t i = 0; i < count; ++i)
+    dynamicResolution.addFrameTime(frameTimeMs);
+}
+
+constexpr float TargetFrameTimeMs = 10.0f;
+//! @brief Number of samples needed for a scale change, see render::DynamicResolution.
+constexpr size_t CoolDownSamples = 30;
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(render_tests)
+
+BOOST_AUTO_TEST_CASE(test_render_target_pool_reuses_released_targets)
+{
+  FakeRenderTargetPool pool;
+  auto first = pool.acquire<float>({4, 3}, "first").get();
+  BOOST_CHECK_EQUAL(first->size.x, 4);
+  BOOST_CHECK_EQUAL(first->size.y, 3);
+  BOOST_CHECK_EQUAL(first->label, "first");
+  const auto* firstPtr = first.get();
+
+  first.reset();
+  const auto second = pool.acquire<float>({4, 3}, "second");
+  BOOST_CHECK_EQUAL(second.get().get(), firstPtr);
+  BOOST_CHECK_EQUAL(pool.size(), size_t{1});
+}
+
+BOOST_AUTO_TEST_CASE(test_render_target_pool_does_not_share_used_targets)
+{
+  FakeRenderTargetPool pool;
+  const auto first = pool.acquire<float>({4, 3}, "first");
+  const auto second = pool.acquire<float>({4, 3}, "second");
+  BOOST_CHECK_NE(first.get(), second.get());
+  BOOST_CHECK_EQUAL(pool.size(), size_t{2});
+}
+
+BOOST_AUTO_TEST_CASE(test_render_target_pool_matches_size_and_pixel_type)
+{
+  FakeRenderTargetPool pool;
+  const FakeTexture* released = pool.acquire<float>({4, 3}, "released").get().get();
+
+  const auto otherSize = pool.acquire<float>({3, 4}, "other-size");
+  const auto otherPixel = pool.acquire<int>({4, 3}, "other-pixel");
+  BOOST_CHECK_NE(static_cast<const FakeTexture*>(otherSize.get().get()), released);
+  BOOST_CHECK_NE(static_cast<const FakeTexture*>(otherPixel.get().get()), released);
+  BOOST_CHECK_EQUAL(otherPixel->label, "other-pixel");
+  BOOST_CHECK_EQUAL(pool.size(), size_t{3});
+}
+
+BOOST_AUTO_TEST_CASE(test_render_target_pool_collects_released_targets)
+{
+  FakeRenderTargetPool pool;
+  const auto kept = pool.acquire<float>({4, 3}, "kept");
+  (void)pool.acquire<float>({4, 3}, "released");
+  (void)pool.acquire<int>({2, 2}, "released");
+  BOOST_CHECK_EQUAL(pool.size(), size_t{3});
+
+  pool.collect();
+  BOOST_CHECK_EQUAL(pool.size(), size_t{1});
+
+  // the kept target must not be handed out again
+  const auto other = pool.acquire<float>({4, 3}, "other");
+  BOOST_CHECK_NE(kept.get(), other.get());
+}
+
+BOOST_AUTO_TEST_CASE(test_dynamic_resolution_quantises_bounds)
+{
+  const render::DynamicResolution dynamicResolution{0.5f, 0.9f, TargetFrameTimeMs};
+  BOOST_CHECK_EQUAL(dynamicResolution.getMaxScale(), 14 * render::DynamicResolution::ScaleStep);
+  BOOST_CHECK_EQUAL(dynamicResolution.getScale(), dynamicResolution.getMaxScale());
+}
+
+BOOST_AUTO_TEST_CASE(test_dynamic_resolution_decreases_after_cool_down)
+{
+  render::DynamicResolution dynamicResolution{0.25f, 1.0f, TargetFrameTimeMs};
+  addFrameTimes(dynamicResolution, CoolDownSamples - 1, 2 * TargetFrameTimeMs);
+  BOOST_CHECK_EQUAL(dynamicResolution.getScale(), 1.0f);
+
+  // twice the target time needs half the pixels, i.e. a scale of 1/sqrt(2), rounded down to the next step
+  addFrameTimes(dynamicResolution, 1, 2 * TargetFrameTimeMs);
+  BOOST_CHECK_EQUAL(dynamicResolution.getScale(), 11 * render::DynamicResolution::ScaleStep);
+
+  // the samples are discarded after a change
+  addFrameTimes(dynamicResolution, CoolDownSamples - 1, 2 * TargetFrameTimeMs);
+  BOOST_CHECK_EQUAL(dynamicResolution.getScale(), 11 * render::DynamicResolution::ScaleStep);
+}
+
+BOOST_AUTO_TEST_CASE(test_dynamic_resolution_increases_one_step_with_headroom)
+{
+  render::DynamicResolution dynamicResolution{0.25f, 1.0f, TargetFrameTimeMs};
+  addFrameTimes(dynamicResolution, CoolDownSamples, 4 * TargetFrameTimeMs);
+  BOOST_CHECK_EQUAL(dynamicResolution.getScale(), 8 * render::DynamicResolution::ScaleStep);
+
+  // the next step would be too close to the target time
+  addFrameTimes(dynamicResolution, CoolDownSamples, 0.8f * TargetFrameTimeMs);
+  BOOST_CHECK_EQUAL(dynamicResolution.getScale(), 8 * render::DynamicResolution::ScaleStep);
+
+  addFrameTimes(dynamicResolution, CoolDownSamples, 0.1f * TargetFrameTimeMs);
+  BOOST_CHECK_EQUAL(dynamicResolution.getScale(), 9 * render::DynamicResolution::ScaleStep);
+}
+
+BOOST_AUTO_TEST_CASE(test_dynamic_resolution_stays_within_bounds)
+{
+  render::DynamicResolution dynamicResolution{0.5f, 1.0f, TargetFrameTimeMs};
+  addFrameTimes(dynamicResolution, CoolDownSamples, 100 * TargetFrameTimeMs);
+  BOOST_CHECK_EQUAL(dynamicResolution.getScale(), 0.5f);
+
+  addFrameTimes(dynamicResolution, 10 * CoolDownSamples, 0.1f * TargetFrameTimeMs);
+  BOOST_CHECK_EQUAL(dynamicResolution.getScale(), 1.0f);
+
+  dynamicResolution.setBounds(0.25f, 0.75f);
+  BOOST_CHECK_EQUAL(dynamicResolution.getScale(), 0.75f);
+  BOOST_CHECK_EQUAL(dynamicResolution.getMaxScale(), 0.75f);
+}
+
+BOOST_AUTO_TEST_CASE(test_render_region_defaults_to_whole_targets)
+{
+  const render::RenderRegion region{};
+  BOOST_CHECK_EQUAL(region.getUvScale().x, 1.0f);
+  BOOST_CHECK_EQUAL(region.getUvScale().y, 1.0f);
+  BOOST_CHECK(region.getViewport({640, 480}) == glm::ivec2(640, 480));
+  BOOST_CHECK(region.getViewport({320, 240}) == glm::ivec2(320, 240));
+}
+
+BOOST_AUTO_TEST_CASE(test_render_region_covers_scaled_targets)
+{
+  const render::RenderRegion region{{1000, 500}, {600, 250}};
+  BOOST_CHECK_CLOSE(region.getUvScale().x, 0.6f, 1e-4f);
+  BOOST_CHECK_CLOSE(region.getUvScale().y, 0.5f, 1e-4f);
+  BOOST_CHECK(region.getViewport({1000, 500}) == glm::ivec2(600, 250));
+  // down-scaled targets are rounded up, so that they cover the whole region
+  BOOST_CHECK(region.getViewport({250, 125}) == glm::ivec2(150, 63));
+  BOOST_CHECK(region.getViewport({1, 1}) == glm::ivec2(1, 1));
+
+  BOOST_CHECK(region == (render::RenderRegion{{1000, 500}, {600, 250}}));
+  BOOST_CHECK(region != (render::RenderRegion{{1000, 500}, {600, 300}}));
+  BOOST_CHECK(region != render::RenderRegion{});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
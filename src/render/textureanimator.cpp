@@ -4,10 +4,7 @@
 #include "loader/file/datatypes.h"
 #include "loader/file/texture.h"
 
-#include <array>
 #include <gl/api/gl.hpp>
-#include <gl/vertexbuffer.h>
-#include <memory>
 #include <utility>
 
 namespace render
@@ -18,9 +15,11 @@ TextureAnimator::TextureAnimator(const std::vector<uint16_t>& data)
 
   const uint16_t* ptr = data.data();
   const auto sequenceCount = *ptr++;
+  size_t firstTile = 0;
   for(size_t i = 0; i < sequenceCount; ++i)
   {
     Sequence sequence;
+    sequence.firstTile = firstTile;
     const auto n = *ptr++;
     for(size_t j = 0; j <= n; ++j)
     {
@@ -29,35 +28,30 @@ TextureAnimator::TextureAnimator(const std::vector<uint16_t>& data)
       sequence.tileIds.emplace_back(tileId);
       m_sequenceByTileId.emplace(tileId, m_sequences.size());
     }
+    firstTile += sequence.tileIds.size();
     m_sequences.emplace_back(std::move(sequence));
   }
 
   BOOST_ASSERT(ptr == &data.back() + 1);
 }
 
-void TextureAnimator::Sequence::updateCoordinates(const std::vector<engine::world::AtlasTile>& tiles)
+void TextureAnimator::uploadTiles(const std::vector<engine::world::AtlasTile>& tiles)
 {
-  BOOST_ASSERT(!tileIds.empty());
-
-  for(const auto& [buffer, vertices] : affectedVertices)
+  std::vector<ShaderTile> shaderTiles;
+  for(const Sequence& sequence : m_sequences)
   {
-    auto uvArray
-      = buffer->map(gl::api::MapBufferAccessMask::MapWriteBit | gl::api::MapBufferAccessMask::MapFlushExplicitBit);
-
-    for(const VertexReference& vref : vertices)
+    BOOST_ASSERT(!sequence.tileIds.empty());
+    BOOST_ASSERT(sequence.firstTile == shaderTiles.size());
+    for(const auto& tileId : sequence.tileIds)
     {
-      BOOST_ASSERT(buffer->size() > 0 && vref.bufferIndex < static_cast<size_t>(buffer->size()));
-      BOOST_ASSERT(vref.queueOffset < tileIds.size());
-      const engine::world::AtlasTile& tile = tiles[tileIds[vref.queueOffset].get()];
-
-      uvArray[vref.bufferIndex].uv
-        = glm::vec3{tile.uvCoordinates[vref.sourceIndex], tile.textureKey.tileAndFlag & loader::file::TextureIndexMask};
-      uvArray[vref.bufferIndex].quadUv12 = glm::vec4{tile.uvCoordinates[0], tile.uvCoordinates[1]};
-      uvArray[vref.bufferIndex].quadUv34 = glm::vec4{tile.uvCoordinates[2], tile.uvCoordinates[3]};
+      const engine::world::AtlasTile& tile = tiles.at(tileId.get());
+      auto& shaderTile = shaderTiles.emplace_back();
+      shaderTile.uv01 = glm::vec4{tile.uvCoordinates[0], tile.uvCoordinates[1]};
+      shaderTile.uv23 = glm::vec4{tile.uvCoordinates[2], tile.uvCoordinates[3]};
+      shaderTile.textureIndex = static_cast<float>(tile.textureKey.tileAndFlag & loader::file::TextureIndexMask);
     }
-
-    buffer->flush();
-    buffer->unmap();
   }
+
+  m_tilesBuffer->setData(shaderTiles, gl::api::BufferUsage::StaticDraw);
 }
 } // namespace render
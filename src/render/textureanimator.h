@@ -6,16 +6,17 @@
 #include <boost/assert.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <gl/buffer.h>
 #include <gl/soglb_fwd.h>
 #include <glm/ext/scalar_int_sized.hpp>
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
 #include <gsl/gsl-lite.hpp>
+#include <gslu.h>
 #include <iterator>
 #include <map>
 #include <memory>
-#include <set>
 #include <vector>
 
 namespace engine::world
@@ -25,6 +26,10 @@ struct AtlasTile;
 
 namespace render
 {
+//! @brief Cycles the tiles of animated texture sequences on the GPU.
+//! @details The tiles of all sequences are stored in a shader storage buffer, and each animated vertex references its
+//!          sequence; the vertex shader then selects the current tile from the animation step, so advancing the
+//!          animation never touches any vertex data.
 class TextureAnimator
 {
 public:
@@ -33,90 +38,85 @@ public:
     glm::vec3 uv{0, 0, -1};
     glm::vec4 quadUv12{};
     glm::vec4 quadUv34{};
+    //! @brief First tile of the sequence in the tile buffer, sequence length, offset of the vertex's own tile within
+    //!        the sequence, and the vertex's corner of the tile; a sequence length of 0 means not animated
+    glm::vec4 animation{0.0f};
 
     explicit AnimatedUV() = default;
-    explicit AnimatedUV(glm::int32 index, const glm::vec2& uv, const glm::vec4& quadUv12, const glm::vec4& quadUv34)
+    explicit AnimatedUV(glm::int32 index,
+                        const glm::vec2& uv,
+                        const glm::vec4& quadUv12,
+                        const glm::vec4& quadUv34,
+                        const glm::vec4& animation)
         : uv{uv, index}
         , quadUv12{quadUv12}
         , quadUv34{quadUv34}
+        , animation{animation}
     {
     }
   };
 
+  struct ShaderTile
+  {
+    glm::vec4 uv01{};
+    glm::vec4 uv23{};
+    float textureIndex = 0;
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    float _pad[3]{};
+  };
+  static_assert(sizeof(ShaderTile) == 48, "Invalid ShaderTile struct size");
+
   explicit TextureAnimator(const std::vector<uint16_t>& data);
 
-  void registerVertex(const core::TextureTileId& tileId,
-                      const std::shared_ptr<gl::VertexBuffer<AnimatedUV>>& buffer,
-                      const int sourceIndex,
-                      const size_t bufferIndex)
+  //! @brief Uploads the tiles of all sequences; must be called once the atlas tiles are known
+  void uploadTiles(const std::vector<engine::world::AtlasTile>& tiles);
+
+  //! @brief The per-vertex animation reference for corner @p sourceIndex of a face using @p tileId
+  [[nodiscard]] glm::vec4 getVertexAnimation(const core::TextureTileId& tileId, int sourceIndex) const
   {
-    auto it = m_sequenceByTileId.find(tileId);
+    Expects(sourceIndex >= 0 && sourceIndex < 4);
+
+    const auto it = m_sequenceByTileId.find(tileId);
     if(it == m_sequenceByTileId.end())
-      return;
+      return glm::vec4{0.0f};
+
+    const auto& sequence = m_sequences.at(it->second);
+    const auto tileIt = std::find(sequence.tileIds.begin(), sequence.tileIds.end(), tileId);
+    Expects(tileIt != sequence.tileIds.end());
+    return glm::vec4{static_cast<float>(sequence.firstTile),
+                     static_cast<float>(sequence.tileIds.size()),
+                     static_cast<float>(std::distance(sequence.tileIds.begin(), tileIt)),
+                     static_cast<float>(sourceIndex)};
+  }
 
-    m_sequences.at(it->second).registerVertex(buffer, Sequence::VertexReference(bufferIndex, sourceIndex), tileId);
+  //! @brief Moves all sequences to their next tile
+  void advance()
+  {
+    ++m_step;
   }
 
-  void updateCoordinates(const std::vector<engine::world::AtlasTile>& tiles)
+  [[nodiscard]] auto getStep() const noexcept
   {
-    for(Sequence& sequence : m_sequences)
-    {
-      sequence.rotate();
-      sequence.updateCoordinates(tiles);
-    }
+    return m_step;
+  }
+
+  [[nodiscard]] const auto& getTilesBuffer() const noexcept
+  {
+    return m_tilesBuffer;
   }
 
 private:
   struct Sequence
   {
-    struct VertexReference
-    {
-      //! Vertex buffer index
-      const size_t bufferIndex;
-      const int sourceIndex;
-      size_t queueOffset = 0;
-
-      VertexReference(const size_t bufferIdx, const int sourceIdx)
-          : bufferIndex(bufferIdx)
-          , sourceIndex(sourceIdx)
-      {
-        Expects(sourceIdx >= 0 && sourceIdx < 4);
-      }
-
-      bool operator<(const VertexReference& rhs) const noexcept
-      {
-        return bufferIndex < rhs.bufferIndex;
-      }
-
-      bool operator==(const VertexReference& rhs) const noexcept
-      {
-        return bufferIndex == rhs.bufferIndex;
-      }
-    };
-
     std::vector<core::TextureTileId> tileIds;
-    std::map<std::shared_ptr<gl::VertexBuffer<AnimatedUV>>, std::set<VertexReference>> affectedVertices;
-
-    void rotate()
-    {
-      BOOST_ASSERT(!tileIds.empty());
-      std::rotate(tileIds.begin(), std::next(tileIds.begin()), tileIds.end());
-    }
-
-    void registerVertex(const std::shared_ptr<gl::VertexBuffer<AnimatedUV>>& buffer,
-                        VertexReference vertex,
-                        const core::TextureTileId& tileId)
-    {
-      const auto it = std::find(tileIds.begin(), tileIds.end(), tileId);
-      Expects(it != tileIds.end());
-      vertex.queueOffset = std::distance(tileIds.begin(), it);
-      affectedVertices[buffer].insert(vertex);
-    }
-
-    void updateCoordinates(const std::vector<engine::world::AtlasTile>& tiles);
+    //! @brief Index of the first tile of this sequence in the tile buffer
+    size_t firstTile = 0;
   };
 
   std::vector<Sequence> m_sequences;
   std::map<core::TextureTileId, size_t> m_sequenceByTileId;
+  gslu::nn_shared<gl::ShaderStorageBuffer<ShaderTile>> m_tilesBuffer{
+    gsl::make_shared<gl::ShaderStorageBuffer<ShaderTile>>("texture-animation-tiles-ssb")};
+  int32_t m_step = 0;
 };
 } // namespace render
@@ -28,6 +28,13 @@ public:
     GL_ASSERT(api::waitSync(m_sync, api::SyncBehaviorFlags::None, api::TimeoutIgnored));
   }
 
+  //! @brief Checks whether the fence has been passed, without blocking.
+  [[nodiscard]] bool isSignaled() const
+  {
+    const auto status = GL_ASSERT_FN(api::clientWaitSync(m_sync, api::SyncObjectMask::SyncFlushCommandsBit, 0));
+    return status == api::SyncStatus::AlreadySignaled || status == api::SyncStatus::ConditionSatisfied;
+  }
+
   // NOLINTNEXTLINE(modernize-use-nodiscard)
   api::SyncStatus clientWait() const
   {
@@ -113,12 +113,18 @@ void Framebuffer::invalidate()
 
 void Framebuffer::blit(const Framebuffer& target, gl::api::BlitFramebufferFilter filter)
 {
+  blit(target, m_size, filter);
+}
+
+void Framebuffer::blit(const Framebuffer& target, const glm::ivec2& sourceSize, gl::api::BlitFramebufferFilter filter)
+{
+  Expects(sourceSize.x <= m_size.x && sourceSize.y <= m_size.y);
   GL_ASSERT(gl::api::blitNamedFramebuffer(getHandle(),
                                           target.getHandle(),
                                           0,
                                           0,
-                                          m_size.x - 1,
-                                          m_size.y - 1,
+                                          sourceSize.x - 1,
+                                          sourceSize.y - 1,
                                           0,
                                           0,
                                           target.m_size.x - 1,
@@ -88,6 +88,11 @@ public:
 
   void blit(const Framebuffer& target, gl::api::BlitFramebufferFilter filter = gl::api::BlitFramebufferFilter::Nearest);
 
+  //! @brief Blits the lower left part of the given size to the whole target.
+  void blit(const Framebuffer& target,
+            const glm::ivec2& sourceSize,
+            gl::api::BlitFramebufferFilter filter = gl::api::BlitFramebufferFilter::Nearest);
+
   void blit(const glm::ivec2& backbufferSize,
             gl::api::BlitFramebufferFilter filter = gl::api::BlitFramebufferFilter::Nearest);
 };
@@ -3,6 +3,7 @@
 #include "bindableresource.h"
 #include "glassert.h"
 
+#include <algorithm>
 #include <glm/gtc/type_ptr.hpp>
 
 namespace gl
@@ -116,6 +117,49 @@ void Uniform::set(const std::vector<glm::vec4>& values)
       ));
 }
 
+namespace
+{
+bool isProgramBinaryFormatSupported(const api::core::EnumType format)
+{
+  int32_t count = 0;
+  GL_ASSERT(api::getIntegerv(api::GetPName::NumProgramBinaryFormats, &count));
+  if(count <= 0)
+    return false;
+
+  std::vector<int32_t> formats(count, 0);
+  GL_ASSERT(api::getIntegerv(api::GetPName::ProgramBinaryFormats, formats.data()));
+  return std::find(formats.begin(), formats.end(), static_cast<int32_t>(format)) != formats.end();
+}
+} // namespace
+
+Program::Program(const std::string_view& label, const ProgramBinary& binary)
+    : Program{label}
+{
+  // the program stays unlinked if the binary is not loaded
+  if(binary.data.empty() || !isProgramBinaryFormatSupported(binary.format))
+    return;
+
+  // a rejected binary raises an error, which is expected here and reported through getLinkStatus() instead
+  api::programBinary(
+    getHandle(), binary.format, binary.data.data(), gsl::narrow<api::core::SizeType>(binary.data.size()));
+  (void)api::getError();
+}
+
+ProgramBinary Program::getBinary() const
+{
+  int32_t length = 0;
+  GL_ASSERT(api::getProgram(getHandle(), api::ProgramProperty::ProgramBinaryLength, &length));
+  if(length <= 0)
+    return {};
+
+  ProgramBinary binary;
+  binary.data.resize(length);
+  api::core::SizeType written = 0;
+  GL_ASSERT(api::getProgramBinary(getHandle(), length, &written, &binary.format, binary.data.data()));
+  binary.data.resize(written);
+  return binary;
+}
+
 bool Program::getLinkStatus() const
 {
   auto success = static_cast<int32_t>(api::Boolean::False);
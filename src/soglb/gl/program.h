@@ -265,35 +265,39 @@ private:
   }
 };
 
+struct ProgramBinary
+{
+  api::core::EnumType format = 0;
+  std::vector<uint8_t> data{};
+};
+
 class Program final : public BindableResource<api::ObjectIdentifier::Program>
 {
 public:
   // NOLINTNEXTLINE(bugprone-reserved-identifier)
   template<api::ShaderType... _Types>
   explicit Program(const std::string_view& label, const Shader<_Types>&... shaders)
-      : BindableResource{[]([[maybe_unused]] const api::core::SizeType n, uint32_t* handle)
-                         {
-                           BOOST_ASSERT(n == 1 && handle != nullptr);
-                           *handle = api::createProgram();
-                         },
-                         api::useProgram,
-                         []([[maybe_unused]] const api::core::SizeType n, const uint32_t* handle)
-                         {
-                           BOOST_ASSERT(n == 1 && handle != nullptr);
-                           api::deleteProgram(*handle);
-                         },
-                         label}
+      : Program{label}
   {
     (...,
      [this, &shaders]()
      {
        GL_ASSERT(api::attachShader(getHandle(), shaders.getHandle()));
      }());
+    GL_ASSERT(api::programParameter(getHandle(),
+                                    api::ProgramParameterPName::ProgramBinaryRetrievableHint,
+                                    static_cast<int32_t>(api::Boolean::True)));
     GL_ASSERT(api::linkProgram(getHandle()));
   }
 
+  //! @brief Loads a program from a binary previously retrieved with getBinary()
+  //! @note Drivers may reject binaries at will, e.g. after an update, which is reported through getLinkStatus().
+  explicit Program(const std::string_view& label, const ProgramBinary& binary);
+
   [[nodiscard]] bool getLinkStatus() const;
 
+  [[nodiscard]] ProgramBinary getBinary() const;
+
   [[nodiscard]] std::string getInfoLog() const;
 
   [[nodiscard]] uint32_t getActiveResourceCount(api::ProgramInterface what) const;
@@ -309,6 +313,22 @@ public:
   [[nodiscard]] std::vector<UniformBlock> getUniformBlocks() const;
 
 private:
+  explicit Program(const std::string_view& label)
+      : BindableResource{[]([[maybe_unused]] const api::core::SizeType n, uint32_t* handle)
+                         {
+                           BOOST_ASSERT(n == 1 && handle != nullptr);
+                           *handle = api::createProgram();
+                         },
+                         api::useProgram,
+                         []([[maybe_unused]] const api::core::SizeType n, const uint32_t* handle)
+                         {
+                           BOOST_ASSERT(n == 1 && handle != nullptr);
+                           api::deleteProgram(*handle);
+                         },
+                         label}
+  {
+  }
+
   template<typename T>
   [[nodiscard]] std::vector<T> getInputs() const
   {
@@ -129,6 +129,15 @@ void replaceIncludes(const std::filesystem::path& filepath,
 }
 } // namespace
 
+std::string readShaderSource(const std::filesystem::path& sourcePath)
+{
+  const std::string source = readAll(sourcePath);
+  std::string out;
+  std::set<std::filesystem::path> included;
+  replaceIncludes(sourcePath, source, out, included);
+  return out;
+}
+
 // NOLINTNEXTLINE(bugprone-reserved-identifier)
 template<api::ShaderType _Type>
 Shader<_Type>::Shader(const gsl::span<gsl::czstring>& src, const std::string_view& label)
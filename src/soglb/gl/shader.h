@@ -12,6 +12,9 @@
 
 namespace gl
 {
+//! @brief Reads a shader source file with all its includes expanded, ready to be passed to Shader::create
+[[nodiscard]] extern std::string readShaderSource(const std::filesystem::path& sourcePath);
+
 // NOLINTNEXTLINE(bugprone-reserved-identifier)
 template<api::ShaderType _Type>
 class Shader final
@@ -72,6 +72,7 @@ class Texture2DArray;
 // NOLINTNEXTLINE(bugprone-reserved-identifier)
 template<typename _T>
 class TextureDepth;
+class TimerQuery;
 template<typename IndexT, typename VertexT0, typename... VertexTs>
 class VertexArray;
 template<typename T>
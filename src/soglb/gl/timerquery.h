@@ -0,0 +1,84 @@
+#pragma once
+
+#include "api/gl.hpp"
+#include "glassert.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace gl
+{
+//! @brief Measures elapsed GPU time without stalling the pipeline.
+//! @details Keeps a ring of queries in flight; results are collected from older frames once the driver reports
+//!          them as available.
+class TimerQuery final
+{
+public:
+  static constexpr size_t Latency = 4;
+
+  TimerQuery(const TimerQuery&) = delete;
+  TimerQuery(TimerQuery&&) = delete;
+  void operator=(const TimerQuery&) = delete;
+  void operator=(TimerQuery&&) = delete;
+
+  explicit TimerQuery()
+  {
+    GL_ASSERT(api::createQuerie(
+      api::QueryTarget::TimeElapsed, static_cast<api::core::SizeType>(Latency), m_handles.data()));
+  }
+
+  ~TimerQuery()
+  {
+    GL_ASSERT(api::deleteQuerie(static_cast<api::core::SizeType>(Latency), m_handles.data()));
+  }
+
+  //! @brief Starts a measurement, unless one is already running or all queries are still waiting for their results.
+  void begin()
+  {
+    if(m_active || m_pending == Latency)
+      return;
+
+    GL_ASSERT(api::beginQuery(api::QueryTarget::TimeElapsed, m_handles[m_write]));
+    m_active = true;
+  }
+
+  void end()
+  {
+    if(!m_active)
+      return;
+
+    GL_ASSERT(api::endQuery(api::QueryTarget::TimeElapsed));
+    m_active = false;
+    m_write = (m_write + 1) % Latency;
+    ++m_pending;
+  }
+
+  //! @brief Collects all available results and returns the most recent one in nanoseconds, if any.
+  [[nodiscard]] std::optional<uint64_t> poll()
+  {
+    std::optional<uint64_t> result;
+    while(m_pending > 0)
+    {
+      const auto handle = m_handles[(m_write + Latency - m_pending) % Latency];
+      uint32_t available = 0;
+      GL_ASSERT(api::getQueryObject(handle, api::QueryObjectParameterName::QueryResultAvailable, &available));
+      if(available == 0)
+        break;
+
+      uint64_t elapsed = 0;
+      GL_ASSERT(api::getQueryObject(handle, api::QueryObjectParameterName::QueryResult, &elapsed));
+      result = elapsed;
+      --m_pending;
+    }
+    return result;
+  }
+
+private:
+  std::array<uint32_t, Latency> m_handles{};
+  size_t m_write = 0;
+  size_t m_pending = 0;
+  bool m_active = false;
+};
+} // namespace gl
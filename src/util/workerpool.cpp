@@ -0,0 +1,151 @@
+#include "workerpool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace util
+{
+WorkerPool::WorkerPool()
+    : WorkerPool{std::max(std::thread::hardware_concurrency(), 1u) - 1u}
+{
+}
+
+WorkerPool::WorkerPool(const size_t workerCount)
+{
+  m_workers.reserve(workerCount);
+  for(size_t i = 0; i < workerCount; ++i)
+  {
+    m_workers.emplace_back(
+      [this]()
+      {
+        workerMain();
+      });
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard lock{m_mutex};
+    m_shutdown = true;
+  }
+  m_jobAvailable.notify_all();
+
+  for(auto& worker : m_workers)
+    worker.join();
+}
+
+void WorkerPool::parallelFor(const size_t count, const std::function<void(size_t)>& fn)
+{
+  if(count == 0)
+    return;
+
+  if(m_workers.empty() || count == 1)
+  {
+    for(size_t i = 0; i < count; ++i)
+      fn(i);
+    return;
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
+    m_job = &fn;
+    m_jobSize = count;
+    m_nextIndex = 0;
+    m_busyWorkers = m_workers.size();
+    ++m_jobGeneration;
+  }
+  m_jobAvailable.notify_all();
+
+  drain();
+
+  std::unique_lock lock{m_mutex};
+  m_jobFinished.wait(lock,
+                     [this]()
+                     {
+                       return m_busyWorkers == 0;
+                     });
+  m_job = nullptr;
+  if(auto exception = std::exchange(m_exception, nullptr))
+    std::rethrow_exception(exception);
+}
+
+void WorkerPool::orderedSplitFor(const size_t count,
+                                 const std::function<bool(size_t)>& isSplit,
+                                 const std::function<void(size_t)>& parallel,
+                                 const std::function<void(size_t)>& commit,
+                                 const std::function<void(size_t)>& serial)
+{
+  size_t runStart = 0;
+  while(runStart < count)
+  {
+    auto runEnd = runStart;
+    while(runEnd < count && isSplit(runEnd))
+      ++runEnd;
+
+    if(runEnd == runStart)
+    {
+      serial(runStart);
+      ++runStart;
+      continue;
+    }
+
+    parallelFor(runEnd - runStart,
+                [runStart, &parallel](const size_t i)
+                {
+                  parallel(runStart + i);
+                });
+    for(auto i = runStart; i < runEnd; ++i)
+      commit(i);
+    runStart = runEnd;
+  }
+}
+
+void WorkerPool::workerMain()
+{
+  uint64_t processedGeneration = 0;
+  while(true)
+  {
+    {
+      std::unique_lock lock{m_mutex};
+      m_jobAvailable.wait(lock,
+                          [this, processedGeneration]()
+                          {
+                            return m_shutdown || m_jobGeneration != processedGeneration;
+                          });
+      if(m_shutdown)
+        return;
+      processedGeneration = m_jobGeneration;
+    }
+
+    drain();
+
+    {
+      std::lock_guard lock{m_mutex};
+      --m_busyWorkers;
+    }
+    m_jobFinished.notify_one();
+  }
+}
+
+void WorkerPool::drain()
+{
+  while(true)
+  {
+    const auto index = m_nextIndex.fetch_add(1);
+    if(index >= m_jobSize)
+      return;
+
+    try
+    {
+      (*m_job)(index);
+    }
+    catch(...)
+    {
+      std::lock_guard lock{m_mutex};
+      if(m_exception == nullptr)
+        m_exception = std::current_exception();
+    }
+  }
+}
+} // namespace util
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace util
+{
+//! @brief A fixed set of worker threads for processing independent work items.
+class WorkerPool final
+{
+public:
+  //! @param workerCount The number of additional threads; the calling thread always participates in the work.
+  explicit WorkerPool(size_t workerCount);
+  WorkerPool();
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool(WorkerPool&&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+  WorkerPool& operator=(WorkerPool&&) = delete;
+
+  //! @brief Calls @a fn for every index in the range [0, count), distributed across all threads.
+  //! @details Blocks until all calls have finished. The first exception thrown by @a fn is re-thrown after all
+  //!          other calls have finished. Must not be called recursively or concurrently.
+  void parallelFor(size_t count, const std::function<void(size_t)>& fn);
+
+  //! @brief Processes the items in the range [0, count) in order, where items accepted by @a isSplit are processed in
+  //!        two phases.
+  //! @details Consecutive split items are processed by calling @a parallel concurrently for all of them, followed by
+  //!          calling @a commit for each of them in order. All other items are processed by calling @a serial between
+  //!          those runs. Thus, every item observes the side effects of all items before it, as long as @a parallel
+  //!          only depends on the state of its own item, and the results are the same as with processing all items
+  //!          serially.
+  void orderedSplitFor(size_t count,
+                       const std::function<bool(size_t)>& isSplit,
+                       const std::function<void(size_t)>& parallel,
+                       const std::function<void(size_t)>& commit,
+                       const std::function<void(size_t)>& serial);
+
+  [[nodiscard]] size_t getWorkerCount() const noexcept
+  {
+    return m_workers.size();
+  }
+
+private:
+  std::vector<std::thread> m_workers;
+  std::mutex m_mutex;
+  std::condition_variable m_jobAvailable;
+  std::condition_variable m_jobFinished;
+  const std::function<void(size_t)>* m_job = nullptr;
+  size_t m_jobSize = 0;
+  std::atomic<size_t> m_nextIndex = 0;
+  uint64_t m_jobGeneration = 0;
+  size_t m_busyWorkers = 0;
+  bool m_shutdown = false;
+  std::exception_ptr m_exception;
+
+  void workerMain();
+  void drain();
+};
+} // namespace util